@@ -0,0 +1,148 @@
+/*
+  Background Sampling of NTC Thermistor
+
+  Samples the NTC 3950 thermistor in the background at 100 Hz:
+  by the Timer1 interrupt on AVR, by a FreeRTOS task on ESP32,
+  by a thread on a host (see NTC_Host.h). loop() reads the latest
+  temperature in constant time, without touching the ADC,
+  and displays it in the default Serial twice a second.
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#include <Thermistor.h>
+#include <NTC_Thermistor.h>
+#include <BackgroundThermistor.h>
+
+#if !defined(ARDUINO)
+  #include <thread>
+#endif
+
+#define SENSOR_PIN             A1
+#define REFERENCE_RESISTANCE   8000
+#define NOMINAL_RESISTANCE     100000
+#define NOMINAL_TEMPERATURE    25
+#define B_VALUE                3950
+
+/**
+  Sampling period (ms), 100 Hz.
+*/
+#define SAMPLING_PERIOD 10
+
+/**
+  Output period (ms).
+*/
+#define OUTPUT_PERIOD 500
+
+BackgroundThermistor<32>* thermistor = NULL;
+
+unsigned long lastOutputTime = 0;
+
+// the setup function runs once when you press reset or power the board
+void setup() {
+  Serial.begin(9600);
+
+#if !defined(ARDUINO)
+  // Analog values of the host: around 25 C.
+  static const int VALUES[] = { 946, 947, 948, 947 };
+  NTC_Host::setAnalogValues(SENSOR_PIN, VALUES, 4);
+#endif
+
+  thermistor = new BackgroundThermistor<32>(
+    SENSOR_PIN,
+    REFERENCE_RESISTANCE,
+    NOMINAL_RESISTANCE,
+    NOMINAL_TEMPERATURE,
+    B_VALUE
+  );
+  startSampling();
+}
+
+// the loop function runs over and over again forever
+void loop() {
+#if !defined(ESP32)
+  // Converts the values sampled since the last call, the ESP32 task does it itself
+  thermistor->process();
+#endif
+
+  if (thermistor->isReady() && (millis() - lastOutputTime >= OUTPUT_PERIOD)) {
+    lastOutputTime = millis();
+    // Output of information, the published reading in all units
+    const ThermistorReading reading = thermistor->read();
+    Serial.print("Temperature: ");
+    Serial.print(reading.celsius);
+    Serial.print(" C, ");
+    Serial.print(reading.kelvin);
+    Serial.print(" K, ");
+    Serial.print(reading.fahrenheit);
+    Serial.println(" F");
+  }
+
+  // ... other work of the loop, never blocked by the thermistor
+}
+
+#if defined(__AVR__)
+
+/**
+  Starts Timer1 in CTC mode: 16 MHz / 256 / 625 = 100 Hz.
+*/
+void startSampling() {
+  noInterrupts();
+  TCCR1A = 0;
+  TCCR1B = (1 << WGM12) | (1 << CS12);
+  TCNT1 = 0;
+  OCR1A = (F_CPU / 256 / 1000) * SAMPLING_PERIOD - 1;
+  TIMSK1 |= (1 << OCIE1A);
+  interrupts();
+}
+
+ISR(TIMER1_COMPA_vect) {
+  thermistor->sample();
+}
+
+#elif defined(ESP32)
+
+/**
+  Samples and converts in a FreeRTOS task,
+  a conversion once per 10 samples.
+*/
+void samplingTask(void*) {
+  TickType_t wakeTime = xTaskGetTickCount();
+  for (int count = 1; ; ++count) {
+    thermistor->sample();
+    if (count % 10 == 0) {
+      thermistor->process();
+    }
+    vTaskDelayUntil(&wakeTime, pdMS_TO_TICKS(SAMPLING_PERIOD));
+  }
+}
+
+void startSampling() {
+  xTaskCreate(samplingTask, "thermistor", 2048, NULL, 1, NULL);
+}
+
+#elif !defined(ARDUINO)
+
+/**
+  Simulates the timer interrupt by a thread.
+*/
+void startSampling() {
+  std::thread([] {
+    for (;;) {
+      thermistor->sample();
+      std::this_thread::sleep_for(std::chrono::milliseconds(SAMPLING_PERIOD));
+    }
+  }).detach();
+}
+
+#else
+
+/**
+  Other boards: call thermistor->sample()
+  from a timer interrupt of the board.
+*/
+void startSampling() {
+}
+
+#endif
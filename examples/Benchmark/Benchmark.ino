@@ -0,0 +1,292 @@
+/*
+  NTC Thermistor Benchmark
+
+  Measures the cost of a temperature reading through
+  the conversion, each class-wrapper and the Thermistor
+  interface, and prints it in the default Serial as CSV:
+  benchmark,parameter,ns_per_sample,cycles_per_sample
+
+  ns_per_sample - time of one call in nanoseconds;
+  cycles_per_sample - CPU cycles of one call: DWT cycle counter
+  on Cortex-M3/M4/M7, cycle counter on ESP32, derived from
+  micros() and F_CPU on AVR, -1 if unknown (host).
+
+  Batch benchmarks convert BATCH_SIZE logged analog values
+  per call: NTC_Thermistor::analogsToKelvins() against
+  resistanceToKelvins() in a loop; their results are per value.
+
+  Analog values come from FakeAdcSource, so the numbers
+  do not include analogRead(). AverageThermistor numbers
+  exclude its nominal delay time between readings.
+
+  Also builds on a host (see NTC_Host.h).
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#include <Thermistor.h>
+#include <NTC_Thermistor.h>
+#include <NTC_TableThermistor.h>
+#include <AverageThermistor.h>
+#include <SmoothThermistor.h>
+#include <MovingAverageThermistor.h>
+#include <FakeAdcSource.h>
+#include <OversamplingAdcSource.h>
+
+#define REFERENCE_RESISTANCE   8000
+#define NOMINAL_RESISTANCE     100000
+#define NOMINAL_TEMPERATURE    25
+#define B_VALUE                3950
+
+/**
+  How many calls are timed per benchmark.
+*/
+#define ITERATIONS 2000
+
+/**
+  Delay time of AverageThermistor readings (ms),
+  the minimum one, excluded from the results.
+*/
+#define AVERAGE_DELAY_TIME 1
+
+#if defined(DWT_CTRL_CYCCNTENA_Msk)
+  #define CYCLE_COUNTER 1
+  #define RESET_CYCLES() (DWT->CYCCNT = 0)
+  #define READ_CYCLES() ((long) DWT->CYCCNT)
+#elif defined(ESP32)
+  #define CYCLE_COUNTER 1
+  #define RESET_CYCLES()
+  #define READ_CYCLES() ((long) ESP.getCycleCount())
+#else
+  #define CYCLE_COUNTER 0
+  #define RESET_CYCLES()
+  #define READ_CYCLES() 0L
+#endif
+
+/**
+  Analog values per call of the batch benchmarks.
+*/
+#define BATCH_SIZE 64
+
+/**
+  Times the expression, ITERATIONS times.
+  The result is kept in a volatile to keep the calls.
+*/
+#define BENCHMARK(name, parameter, excludedMicros, expression) { \
+    volatile double sink; \
+    RESET_CYCLES(); \
+    const long startCycles = READ_CYCLES(); \
+    const unsigned long start = micros(); \
+    for (int i = 0; i < ITERATIONS; ++i) { \
+      sink = (expression); \
+    } \
+    const unsigned long time = micros() - start - (excludedMicros); \
+    const long cycles = READ_CYCLES() - startCycles; \
+    (void) sink; \
+    report(name, parameter, ITERATIONS, time, cycles); \
+  }
+
+/**
+  Times the statement that converts BATCH_SIZE values,
+  ITERATIONS / BATCH_SIZE times, so the results are per value.
+*/
+#define BENCHMARK_BATCH(name, statement) { \
+    RESET_CYCLES(); \
+    const long startCycles = READ_CYCLES(); \
+    const unsigned long start = micros(); \
+    for (int i = 0; i < ITERATIONS / BATCH_SIZE; ++i) { \
+      statement; \
+    } \
+    const unsigned long time = micros() - start; \
+    const long cycles = READ_CYCLES() - startCycles; \
+    report(name, BATCH_SIZE, (ITERATIONS / BATCH_SIZE) * BATCH_SIZE, time, cycles); \
+  }
+
+/**
+  Exposes the per-value conversion of NTC_Thermistor
+  to compare it with the batch conversion.
+*/
+class ExposedThermistor : public NTC_Thermistor {
+
+  public:
+    using NTC_Thermistor::NTC_Thermistor;
+    using NTC_Thermistor::analogToKelvins;
+};
+
+// Analog values around 25 C (947 for R0 = 8k, Rn = 100k), 0...1023.
+const int ANALOG_VALUES[] = { 947, 948, 946, 949, 945, 947, 950, 944 };
+
+FakeAdcSource source(ANALOG_VALUES, 8);
+
+// the setup function runs once when you press reset or power the board
+void setup() {
+  Serial.begin(9600);
+  enableCycleCounter();
+
+  Serial.println("benchmark,parameter,ns_per_sample,cycles_per_sample");
+
+  NTC_Thermistor ntc(
+    &source,
+    REFERENCE_RESISTANCE,
+    NOMINAL_RESISTANCE,
+    NOMINAL_TEMPERATURE,
+    B_VALUE
+  );
+  // volatile, so the compiler cannot replace virtual calls by direct ones.
+  Thermistor* volatile thermistor = &ntc;
+
+  BENCHMARK("ntc_read_kelvin_direct", 0, 0, ntc.readKelvin());
+  BENCHMARK("ntc_read_kelvin_virtual", 0, 0, thermistor->readKelvin());
+  BENCHMARK("ntc_read_celsius_virtual", 0, 0, thermistor->readCelsius());
+  BENCHMARK("ntc_read_centi_celsius_virtual", 0, 0, thermistor->readCentiCelsius());
+  BENCHMARK("ntc_read_all_units_virtual", 0, 0, thermistor->read().kelvin);
+
+  // Logged analog values, 20...95 C, converted afterwards.
+  uint16_t analogs[BATCH_SIZE];
+  float kelvins[BATCH_SIZE];
+  for (int i = 0; i < BATCH_SIZE; ++i) {
+    analogs[i] = 520 + i * 7;
+  }
+  ExposedThermistor exposed(
+    &source,
+    REFERENCE_RESISTANCE,
+    NOMINAL_RESISTANCE,
+    NOMINAL_TEMPERATURE,
+    B_VALUE
+  );
+  BENCHMARK_BATCH("loop_resistance_to_kelvins",
+    for (int j = 0; j < BATCH_SIZE; ++j) {
+      kelvins[j] = exposed.analogToKelvins(analogs[j]);
+    });
+  BENCHMARK_BATCH("batch_analogs_to_kelvins",
+    exposed.analogsToKelvins(analogs, kelvins, BATCH_SIZE));
+
+  NTC_TableThermistor table(
+    &source,
+    REFERENCE_RESISTANCE,
+    NOMINAL_RESISTANCE,
+    NOMINAL_TEMPERATURE,
+    B_VALUE,
+    33
+  );
+  thermistor = &table;
+  BENCHMARK("table_read_kelvin_virtual", 33, 0, thermistor->readKelvin());
+
+  const int readingsNumbers[] = { 1, 4, 16 };
+  for (int i = 0; i < 3; ++i) {
+    thermistor = new AverageThermistor(
+      new NTC_Thermistor(
+        &source,
+        REFERENCE_RESISTANCE,
+        NOMINAL_RESISTANCE,
+        NOMINAL_TEMPERATURE,
+        B_VALUE
+      ),
+      readingsNumbers[i],
+      AVERAGE_DELAY_TIME
+    );
+    const unsigned long delays = 1000UL * AVERAGE_DELAY_TIME * readingsNumbers[i] * ITERATIONS;
+    BENCHMARK("average_read_celsius", readingsNumbers[i], delays, thermistor->readCelsius());
+    delete thermistor;
+  }
+
+  const int smoothingFactors[] = { 2, 5, 20 };
+  for (int i = 0; i < 3; ++i) {
+    thermistor = new SmoothThermistor(
+      new NTC_Thermistor(
+        &source,
+        REFERENCE_RESISTANCE,
+        NOMINAL_RESISTANCE,
+        NOMINAL_TEMPERATURE,
+        B_VALUE
+      ),
+      smoothingFactors[i]
+    );
+    BENCHMARK("smooth_read_celsius", smoothingFactors[i], 0, thermistor->readCelsius());
+    delete thermistor;
+  }
+
+  thermistor = new MovingAverageThermistor<16>(
+    new NTC_Thermistor(
+      &source,
+      REFERENCE_RESISTANCE,
+      NOMINAL_RESISTANCE,
+      NOMINAL_TEMPERATURE,
+      B_VALUE
+    )
+  );
+  BENCHMARK("moving_average_read_celsius", 16, 0, thermistor->readCelsius());
+  delete thermistor;
+
+  // 4^bits analog values, one conversion.
+  for (int bits = 1; bits <= 2; ++bits) {
+    AdcSource* oversamplingSource = new OversamplingAdcSource(
+      new FakeAdcSource(ANALOG_VALUES, 8), bits
+    );
+    thermistor = new NTC_Thermistor(
+      oversamplingSource,
+      REFERENCE_RESISTANCE,
+      NOMINAL_RESISTANCE,
+      NOMINAL_TEMPERATURE,
+      B_VALUE
+    );
+    BENCHMARK("oversampling_read_celsius", 1 << (2 * bits), 0, thermistor->readCelsius());
+    delete thermistor;
+    delete oversamplingSource;
+  }
+
+  // SmoothThermistor -> AverageThermistor -> NTC_Thermistor
+  thermistor = new SmoothThermistor(
+    new AverageThermistor(
+      new NTC_Thermistor(
+        &source,
+        REFERENCE_RESISTANCE,
+        NOMINAL_RESISTANCE,
+        NOMINAL_TEMPERATURE,
+        B_VALUE
+      ),
+      10,
+      AVERAGE_DELAY_TIME
+    ),
+    5
+  );
+  BENCHMARK("smooth_average_read_celsius", 10, 1000UL * AVERAGE_DELAY_TIME * 10 * ITERATIONS,
+    thermistor->readCelsius());
+  delete thermistor;
+}
+
+// the loop function runs over and over again forever
+void loop() {
+}
+
+/**
+  Starts the cycle counter, if the board has one.
+*/
+void enableCycleCounter() {
+#if defined(DWT_CTRL_CYCCNTENA_Msk)
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+/**
+  Prints one CSV line of a benchmark, per one of the samples.
+*/
+void report(const char* name, long parameter, long samples, unsigned long time, long cycles) {
+  Serial.print(name);
+  Serial.print(",");
+  Serial.print(parameter);
+  Serial.print(",");
+  Serial.print(time * 1000.0 / samples, 1);
+  Serial.print(",");
+#if CYCLE_COUNTER
+  Serial.println((double) cycles / samples, 1);
+#elif defined(F_CPU)
+  (void) cycles;
+  Serial.println(time * (F_CPU / 1000000.0) / samples, 1);
+#else
+  (void) cycles;
+  Serial.println(-1);
+#endif
+}
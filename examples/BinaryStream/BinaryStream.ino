@@ -0,0 +1,174 @@
+/*
+  Binary Stream of NTC Thermistor
+
+  Streams temperatures of the NTC 3950 thermistor
+  in the default Serial as binary frames (see ThermistorStream)
+  instead of text, decoded on a PC by
+  extras/ThermistorStreamDecoder (ntc_decode):
+  ntc_decode < /dev/ttyUSB0
+
+  On start, prints (as text, skipped by the decoder)
+  the cost of text output against binary frames,
+  without sending, for 1 and 8 channels:
+  output,channels,bytes_per_reading,us_per_reading
+
+  text - "Temperature: 25.07 C, 298.22 K, 77.13 F" per channel,
+  as the SerialReading example prints;
+  frame - temperatures in hundredths of degree Celsius,
+  one frame for all channels.
+
+  Also builds on a host (see NTC_Host.h):
+  the sketch output piped into ntc_decode.
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#include <Thermistor.h>
+#include <NTC_Thermistor.h>
+#include <ThermistorStream.h>
+
+#define SENSOR_PIN             A1
+#define REFERENCE_RESISTANCE   8000
+#define NOMINAL_RESISTANCE     100000
+#define NOMINAL_TEMPERATURE    25
+#define B_VALUE                3950
+
+/**
+  How many readings are timed.
+*/
+#define ITERATIONS 1000
+
+/**
+  Channels of the multi-channel benchmark.
+*/
+#define CHANNELS 8
+
+/**
+  Output that counts bytes and sends nothing.
+*/
+class CountingPrint final : public Print {
+
+  public:
+    using Print::write;
+    unsigned long bytes = 0;
+
+    size_t write(uint8_t) override {
+      ++this->bytes;
+      return 1;
+    }
+
+    size_t write(const uint8_t*, size_t size) override {
+      this->bytes += size;
+      return size;
+    }
+};
+
+CountingPrint counter;
+Thermistor* thermistor = NULL;
+ThermistorStream<1> stream(Serial);
+
+// the setup function runs once when you press reset or power the board
+void setup() {
+  Serial.begin(115200);
+
+#ifndef ARDUINO
+  // Host build: the analog port returns readings around 25 C.
+  static const int ANALOG_VALUES[] = { 947, 947, 946, 946, 945, 946, 947, 948 };
+  NTC_Host::setAnalogValues(SENSOR_PIN, ANALOG_VALUES, 8);
+#endif
+
+  Serial.println("output,channels,bytes_per_reading,us_per_reading");
+  benchmarkText(1);
+  benchmarkFrame1();
+  benchmarkText(CHANNELS);
+  benchmarkFrame8();
+
+  thermistor = new NTC_Thermistor(
+    SENSOR_PIN,
+    REFERENCE_RESISTANCE,
+    NOMINAL_RESISTANCE,
+    NOMINAL_TEMPERATURE,
+    B_VALUE
+  );
+}
+
+// the loop function runs over and over again forever
+void loop() {
+  // Reads temperature in integers and writes a frame of 8 or 9 bytes
+  stream.writeCentiCelsius(0, thermistor->readCentiCelsius());
+
+  delay(100); // optionally, only to delay the output of information in the example.
+}
+
+/**
+  @return temperature of a reading of the benchmark,
+  slowly changing around 25 C (hundredths of degree Celsius)
+*/
+int32_t centiCelsiusOf(const int reading, const int channel) {
+  return 2500 + channel * 100 + (reading % 64) - 32;
+}
+
+/**
+  Times the text output of readings of the channels.
+*/
+void benchmarkText(const int channels) {
+  counter.bytes = 0;
+  const unsigned long start = micros();
+  for (int i = 0; i < ITERATIONS; ++i) {
+    for (int channel = 0; channel < channels; ++channel) {
+      const double celsius = centiCelsiusOf(i, channel) / 100.0;
+      counter.print("Temperature: ");
+      counter.print(celsius);
+      counter.print(" C, ");
+      counter.print(celsius + 273.15);
+      counter.print(" K, ");
+      counter.print(celsius * 1.8 + 32);
+      counter.println(" F");
+    }
+  }
+  report("text", channels, micros() - start);
+}
+
+/**
+  Times the frames of readings of one channel.
+*/
+void benchmarkFrame1() {
+  ThermistorStream<1> frames(counter);
+  counter.bytes = 0;
+  const unsigned long start = micros();
+  for (int i = 0; i < ITERATIONS; ++i) {
+    frames.writeCentiCelsius(0, centiCelsiusOf(i, 0));
+  }
+  report("frame", 1, micros() - start);
+}
+
+/**
+  Times the frames of readings of CHANNELS channels.
+*/
+void benchmarkFrame8() {
+  ThermistorStream<CHANNELS> frames(counter);
+  int32_t centiCelsius[CHANNELS];
+  counter.bytes = 0;
+  const unsigned long start = micros();
+  for (int i = 0; i < ITERATIONS; ++i) {
+    for (int channel = 0; channel < CHANNELS; ++channel) {
+      centiCelsius[channel] = centiCelsiusOf(i, channel);
+    }
+    frames.writeCentiCelsius(0, centiCelsius, CHANNELS);
+  }
+  report("frame", CHANNELS, micros() - start);
+}
+
+/**
+  Prints a line of the benchmark.
+*/
+void report(const char* output, const int channels, const unsigned long time) {
+  Serial.print(output);
+  Serial.print(",");
+  Serial.print(channels);
+  Serial.print(",");
+  Serial.print((double) counter.bytes / ITERATIONS, 1);
+  Serial.print(",");
+  Serial.println((double) time / ITERATIONS, 3);
+}
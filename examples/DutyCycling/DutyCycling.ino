@@ -0,0 +1,100 @@
+/*
+  Duty-Cycled NTC Thermistor
+
+  Powers the divider of the NTC 3950 thermistor by a digital port
+  only around a reading, once per period, without blocking loop()
+  for the settle time, and displays the temperature and the energy
+  of the reading in the default Serial.
+
+  Circuit: EXCITATION_PIN -> R0 -> SENSOR_PIN -> NTC -> GND
+  (instead of the reference voltage -> R0).
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#include <Thermistor.h>
+#include <NTC_Thermistor.h>
+#include <DutyCycledThermistor.h>
+
+#define SENSOR_PIN             A1
+#define EXCITATION_PIN         7
+#define REFERENCE_RESISTANCE   8000
+#define NOMINAL_RESISTANCE     100000
+#define NOMINAL_TEMPERATURE    25
+#define B_VALUE                3950
+
+/**
+  Voltage of the excitation pin (V).
+*/
+#define SUPPLY_VOLTAGE 5.0
+
+/**
+  Time from power on to a reading (us):
+  5 time constants of the divider and its filter capacitor.
+*/
+#define SETTLE_TIME 1000
+
+/**
+  Time between readings (ms).
+*/
+#define PERIOD 60000
+
+DutyCycledThermistor* thermistor = NULL;
+
+// the setup function runs once when you press reset or power the board
+void setup() {
+  Serial.begin(9600);
+
+#ifndef ARDUINO
+  // Host build: the analog port returns a reading of 25 C.
+  static const int ANALOG_VALUES[] = { 947 };
+  NTC_Host::setAnalogValues(SENSOR_PIN, ANALOG_VALUES, 1);
+#endif
+
+  thermistor = new DutyCycledThermistor(
+    new NTC_Thermistor(
+      SENSOR_PIN,
+      REFERENCE_RESISTANCE,
+      NOMINAL_RESISTANCE,
+      NOMINAL_TEMPERATURE,
+      B_VALUE
+    ),
+    EXCITATION_PIN,
+    SETTLE_TIME,
+    PERIOD
+  );
+}
+
+// the loop function runs over and over again forever
+void loop() {
+  // Powers on when it is time, reads after the settle time,
+  // returns immediately otherwise
+  if (thermistor->update()) {
+    const ThermistorReading reading = thermistor->getReading();
+    // Divider current while powered and energy of the reading.
+    const double current = SUPPLY_VOLTAGE / (REFERENCE_RESISTANCE + reading.resistance);
+    const unsigned long poweredTime = thermistor->getPoweredTime();
+    const double energy = SUPPLY_VOLTAGE * current * poweredTime; // uJ
+    // Power of the NTC while powered, heats it up.
+    const double heating = current * current * reading.resistance;
+
+    Serial.print("Temperature: ");
+    Serial.print(reading.celsius);
+    Serial.println(" C");
+    Serial.print("Powered: ");
+    Serial.print(poweredTime);
+    Serial.print(" us, energy: ");
+    Serial.print(energy, 3);
+    Serial.print(" uJ, average: ");
+    Serial.print(energy / PERIOD * 1000000.0, 3);
+    Serial.println(" nW");
+    Serial.print("Continuous divider: ");
+    Serial.print(SUPPLY_VOLTAGE * current * 1000.0, 3);
+    Serial.print(" mW, of it in the NTC: ");
+    Serial.print(heating * 1000.0, 3);
+    Serial.println(" mW");
+  }
+
+  // ... other work of the loop (or sleep), never blocked by the settle time
+}
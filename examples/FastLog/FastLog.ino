@@ -0,0 +1,127 @@
+/*
+  Fast Logarithm of NTC Thermistor
+
+  Compares the logarithms of the B-value equation:
+  libm log(), NTC_FastLog::ln() (single precision)
+  and NTC_FastLog::log2Fixed() (fixed point, Q15),
+  and prints in the default Serial as CSV:
+  kernel,max_error_k,ns_per_call
+
+  max_error_k - maximum error of the temperature
+  against the one with libm log(), over the analog values
+  of the NTC 3950 thermistor from -40 C to 150 C;
+  ns_per_call - time of one logarithm in nanoseconds.
+
+  The library uses the fast logarithms
+  with the build flag -DNTC_FAST_LOG=1 (see NTC_FastLog.h).
+
+  Also builds on a host (see NTC_Host.h).
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#include <Thermistor.h>
+#include <NTC_FastLog.h>
+
+#define REFERENCE_RESISTANCE   8000
+#define NOMINAL_RESISTANCE     100000
+#define NOMINAL_TEMPERATURE    25
+#define B_VALUE                3950
+#define ANALOG_RESOLUTION      1023
+
+#define LOWEST_CELSIUS -40
+#define HIGHEST_CELSIUS 150
+
+/**
+  How many times the analog range is timed.
+*/
+#define REPEATS 10
+
+// 1/K = OFFSET + ln(V / (ADC - V)) / B, see ThermistorBank.
+const double OFFSET = 1.0 / (NOMINAL_TEMPERATURE + 273.15) +
+  log((double) REFERENCE_RESISTANCE / NOMINAL_RESISTANCE) / B_VALUE;
+
+// the setup function runs once when you press reset or power the board
+void setup() {
+  Serial.begin(9600);
+
+  Serial.println("kernel,max_error_k,ns_per_call");
+  for (int kernel = 0; kernel < 3; ++kernel) {
+    double maxError = 0;
+    for (int analog = 1; analog < ANALOG_RESOLUTION; ++analog) {
+      const double expected = toKelvins(logRatio(0, analog));
+      const double celsius = expected - 273.15;
+      if ((celsius >= LOWEST_CELSIUS) && (celsius <= HIGHEST_CELSIUS)) {
+        const double error = toKelvins(logRatio(kernel, analog)) - expected;
+        maxError = max(maxError, fabs(error));
+      }
+    }
+    Serial.print(kernelName(kernel));
+    Serial.print(",");
+    Serial.print(maxError, 5);
+    Serial.print(",");
+    Serial.println(timeKernel(kernel), 1);
+  }
+}
+
+// the loop function runs over and over again forever
+void loop() {
+}
+
+/**
+  @return ln(V / (ADC - V)) by the kernel
+*/
+double logRatio(int kernel, int analog) {
+  const double ratio = (double) analog / (ANALOG_RESOLUTION - analog);
+  switch (kernel) {
+    case 1:
+      return NTC_FastLog::ln((float) ratio);
+    case 2:
+      return (NTC_FastLog::log2Fixed(analog) -
+        NTC_FastLog::log2Fixed(ANALOG_RESOLUTION - analog)) * (M_LN2 / 32768);
+    default:
+      return log(ratio);
+  }
+}
+
+double toKelvins(double logarithm) {
+  return 1.0 / (OFFSET + logarithm / B_VALUE);
+}
+
+const char* kernelName(int kernel) {
+  switch (kernel) {
+    case 1:
+      return "fast_ln_float";
+    case 2:
+      return "fast_log2_fixed";
+    default:
+      return "libm_log";
+  }
+}
+
+/**
+  @return time of one logarithm of the kernel in nanoseconds
+*/
+double timeKernel(int kernel) {
+  volatile double doubleSink = 0;
+  volatile float floatSink = 0;
+  volatile int32_t fixedSink = 0;
+  const unsigned long start = micros();
+  for (int i = 0; i < REPEATS; ++i) {
+    for (int analog = 1; analog < ANALOG_RESOLUTION; ++analog) {
+      if (kernel == 1) {
+        floatSink = NTC_FastLog::ln((float) analog);
+      } else if (kernel == 2) {
+        fixedSink = NTC_FastLog::log2Fixed(analog);
+      } else {
+        doubleSink = log((double) analog);
+      }
+    }
+  }
+  const unsigned long time = micros() - start;
+  (void) doubleSink;
+  (void) floatSink;
+  (void) fixedSink;
+  return time * 1000.0 / ((double) REPEATS * (ANALOG_RESOLUTION - 1));
+}
@@ -0,0 +1,128 @@
+/*
+  Fixed-Point NTC Thermistor
+
+  Reads a temperature from the NTC 3950 thermistor
+  in hundredths of degree Celsius with integer arithmetic
+  only and displays it in the default Serial.
+
+  On start, prints an accuracy report of the integer
+  conversion against the floating-point (log()) conversion
+  over the full ADC range, and the time of both conversions.
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#include <Thermistor.h>
+#include <NTC_Thermistor.h>
+
+#define SENSOR_PIN             A1
+#define REFERENCE_RESISTANCE   8000
+#define NOMINAL_RESISTANCE     100000
+#define NOMINAL_TEMPERATURE    25
+#define B_VALUE                3950
+#define ANALOG_RESOLUTION      1023
+
+/**
+  NTC thermistor that reads a given analog value
+  instead of the analog port, to sweep the ADC range.
+*/
+class SweepThermistor final : public NTC_Thermistor {
+  public:
+    int analog = 0;
+
+    SweepThermistor() : NTC_Thermistor(
+      SENSOR_PIN,
+      REFERENCE_RESISTANCE,
+      NOMINAL_RESISTANCE,
+      NOMINAL_TEMPERATURE,
+      B_VALUE,
+      ANALOG_RESOLUTION
+    ) {}
+
+  protected:
+    int readAnalog() override {
+      return analog;
+    }
+};
+
+Thermistor* thermistor = NULL;
+
+// the setup function runs once when you press reset or power the board
+void setup() {
+  Serial.begin(9600);
+
+  thermistor = new NTC_Thermistor(
+    SENSOR_PIN,
+    REFERENCE_RESISTANCE,
+    NOMINAL_RESISTANCE,
+    NOMINAL_TEMPERATURE,
+    B_VALUE,
+    ANALOG_RESOLUTION
+  );
+
+  printAccuracyReport();
+}
+
+// the loop function runs over and over again forever
+void loop() {
+  // Reads temperature
+  const int32_t centiCelsius = thermistor->readCentiCelsius();
+
+  // Output of information
+  Serial.print("Temperature: ");
+  Serial.print(centiCelsius / 100);
+  Serial.print(".");
+  const int32_t fraction = abs(centiCelsius % 100);
+  if (fraction < 10) {
+    Serial.print("0");
+  }
+  Serial.print(fraction);
+  Serial.println(" C");
+
+  delay(500); // optionally, only to delay the output of information in the example.
+}
+
+/**
+  Compares the integer and the floating-point conversions
+  for every analog value, where the thermistor
+  is in -40...150 C range.
+*/
+void printAccuracyReport() {
+  SweepThermistor sweep;
+  double maxError = 0;
+  int maxErrorAnalog = 0;
+  unsigned long integerTime = 0;
+  unsigned long floatTime = 0;
+  int count = 0;
+  for (int analog = 1; analog < ANALOG_RESOLUTION; ++analog) {
+    sweep.analog = analog;
+    unsigned long start = micros();
+    const double celsius = sweep.readCelsius();
+    floatTime += micros() - start;
+    start = micros();
+    const int32_t centiCelsius = sweep.readCentiCelsius();
+    integerTime += micros() - start;
+    if ((celsius < -40) || (celsius > 150)) {
+      continue;
+    }
+    const double error = abs(centiCelsius / 100.0 - celsius);
+    if (error > maxError) {
+      maxError = error;
+      maxErrorAnalog = analog;
+    }
+    ++count;
+  }
+  Serial.print("Analog values in -40...150 C: ");
+  Serial.println(count);
+  Serial.print("Max error: ");
+  Serial.print(maxError, 3);
+  Serial.print(" C at analog value ");
+  Serial.println(maxErrorAnalog);
+  Serial.print("Float: ");
+  Serial.print((double) floatTime / (ANALOG_RESOLUTION - 1));
+  Serial.println(" us/conversion");
+  Serial.print("Integer: ");
+  Serial.print((double) integerTime / (ANALOG_RESOLUTION - 1));
+  Serial.println(" us/conversion");
+}
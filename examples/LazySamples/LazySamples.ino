@@ -0,0 +1,156 @@
+/*
+  Lazy Samples of NTC Thermistor
+
+  Averages 16 analog values of the NTC 3950 thermistor
+  and converts the mean only when a temperature is needed
+  (see SampleThermistor), and displays it in the default Serial.
+
+  On start, compares the cost of a reading of 16 averaged
+  values on scripted analog values as CSV:
+  pipeline,conversions_per_reading,us_per_reading,celsius
+
+  average_thermistor - AverageThermistor, converts every value;
+  average_sample - AverageSampleThermistor through
+  SampleThermistorAdapter, converts the mean once;
+  average_sample_analog - AverageSampleThermistor, only the analog
+  value of the sample is used (logging, thresholds), no conversion.
+  Times exclude the delay between averaged values.
+
+  Also builds on a host (see NTC_Host.h).
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#include <Thermistor.h>
+#include <NTC_Thermistor.h>
+#include <AverageThermistor.h>
+#include <AverageSampleThermistor.h>
+#include <SmoothSampleThermistor.h>
+#include <SampleThermistorAdapter.h>
+#include <FakeAdcSource.h>
+
+#define SENSOR_PIN             A1
+#define REFERENCE_RESISTANCE   8000
+#define NOMINAL_RESISTANCE     100000
+#define NOMINAL_TEMPERATURE    25
+#define B_VALUE                3950
+
+/**
+  How many analog values are averaged.
+*/
+#define READINGS_NUMBER 16
+
+/**
+  How many readings are timed.
+*/
+#define ITERATIONS 200
+
+// Analog values around 25 C, 0...1023.
+const int ANALOG_VALUES[] = { 947, 946, 948, 947, 945, 949, 947, 946 };
+
+FakeAdcSource source(ANALOG_VALUES, 8);
+
+SampleThermistor* sampleThermistor = NULL;
+
+// the setup function runs once when you press reset or power the board
+void setup() {
+  Serial.begin(9600);
+
+#ifndef ARDUINO
+  // Host build: the analog port returns the same values.
+  NTC_Host::setAnalogValues(SENSOR_PIN, ANALOG_VALUES, 8);
+#endif
+
+  Serial.println("pipeline,conversions_per_reading,us_per_reading,celsius");
+
+  Thermistor* average = new AverageThermistor(newThermistor(), READINGS_NUMBER, 1);
+  unsigned long start = micros();
+  double celsius = 0;
+  for (int i = 0; i < ITERATIONS; ++i) {
+    celsius = average->readCelsius();
+  }
+  report("average_thermistor", READINGS_NUMBER, micros() - start, READINGS_NUMBER, celsius);
+  delete average;
+
+  Thermistor* adapter = new SampleThermistorAdapter(
+    new AverageSampleThermistor(newThermistor(), READINGS_NUMBER, 1)
+  );
+  start = micros();
+  for (int i = 0; i < ITERATIONS; ++i) {
+    celsius = adapter->readCelsius();
+  }
+  report("average_sample", 1, micros() - start, READINGS_NUMBER - 1, celsius);
+  delete adapter;
+
+  SampleThermistor* samples = new AverageSampleThermistor(newThermistor(), READINGS_NUMBER, 1);
+  start = micros();
+  volatile double analog = 0;
+  for (int i = 0; i < ITERATIONS; ++i) {
+    analog = samples->readSample().getAnalog();
+  }
+  report("average_sample_analog", 0, micros() - start, READINGS_NUMBER - 1, NAN);
+  (void) analog;
+  delete samples;
+
+  sampleThermistor = new SmoothSampleThermistor(
+    new AverageSampleThermistor(
+      new NTC_Thermistor(
+        SENSOR_PIN,
+        REFERENCE_RESISTANCE,
+        NOMINAL_RESISTANCE,
+        NOMINAL_TEMPERATURE,
+        B_VALUE
+      ),
+      READINGS_NUMBER
+    ),
+    4
+  );
+}
+
+// the loop function runs over and over again forever
+void loop() {
+  // Averaged and smoothed analog value, not converted yet
+  LazySample sample = sampleThermistor->readSample();
+
+  // Output of information, converted once for all units
+  Serial.print("Analog: ");
+  Serial.print(sample.getAnalog());
+  Serial.print(", temperature: ");
+  Serial.print(sample.getCelsius());
+  Serial.print(" C, ");
+  Serial.print(sample.getKelvin());
+  Serial.print(" K, ");
+  Serial.print(sample.getFahrenheit());
+  Serial.println(" F");
+
+  delay(500); // optionally, only to delay the output of information in the example.
+}
+
+/**
+  Returns a new thermistor that reads the scripted values.
+*/
+NTC_Thermistor* newThermistor() {
+  return new NTC_Thermistor(
+    &source,
+    REFERENCE_RESISTANCE,
+    NOMINAL_RESISTANCE,
+    NOMINAL_TEMPERATURE,
+    B_VALUE
+  );
+}
+
+/**
+  Prints a line of the comparison,
+  the delays between averaged values excluded.
+*/
+void report(const char* pipeline, int conversions, unsigned long time, int delays, double celsius) {
+  time -= (unsigned long) ITERATIONS * delays * 1000;
+  Serial.print(pipeline);
+  Serial.print(",");
+  Serial.print(conversions);
+  Serial.print(",");
+  Serial.print((double) time / ITERATIONS, 3);
+  Serial.print(",");
+  Serial.println(celsius, 3);
+}
@@ -0,0 +1,118 @@
+/*
+  Lookup Table NTC Thermistor
+
+  Reads a temperature from the NTC 3950 thermistor
+  through a precomputed lookup table, compares the cost
+  of a reading with the B-value equation (log()) path
+  and displays it in the default Serial.
+
+  Also prints the table content, ready to be pasted
+  into a sketch as a PROGMEM array.
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#include <Thermistor.h>
+#include <NTC_Thermistor.h>
+#include <NTC_TableThermistor.h>
+
+#define SENSOR_PIN             A1
+#define REFERENCE_RESISTANCE   8000
+#define NOMINAL_RESISTANCE     100000
+#define NOMINAL_TEMPERATURE    25
+#define B_VALUE                3950
+
+/**
+  Number of table entries.
+  33 entries (132 bytes) from -40 C to 150 C, 6 C apart,
+  are interpolated between within 0.3 C.
+*/
+#define TABLE_SIZE 33
+
+/**
+  How many readings are timed in the benchmark.
+*/
+#define BENCHMARK_READINGS 1000
+
+NTC_TableThermistor* tableThermistor = NULL;
+Thermistor* equationThermistor = NULL;
+
+// the setup function runs once when you press reset or power the board
+void setup() {
+  Serial.begin(9600);
+
+  tableThermistor = new NTC_TableThermistor(
+    SENSOR_PIN,
+    REFERENCE_RESISTANCE,
+    NOMINAL_RESISTANCE,
+    NOMINAL_TEMPERATURE,
+    B_VALUE,
+    TABLE_SIZE
+  );
+  equationThermistor = new NTC_Thermistor(
+    SENSOR_PIN,
+    REFERENCE_RESISTANCE,
+    NOMINAL_RESISTANCE,
+    NOMINAL_TEMPERATURE,
+    B_VALUE
+  );
+
+  printTable();
+  Serial.print("Equation: ");
+  Serial.print(benchmark(equationThermistor));
+  Serial.println(" us/reading");
+  Serial.print("Table: ");
+  Serial.print(benchmark(tableThermistor));
+  Serial.println(" us/reading");
+}
+
+// the loop function runs over and over again forever
+void loop() {
+  // Reads temperature
+  const double celsius = tableThermistor->readCelsius();
+  const double kelvin = tableThermistor->readKelvin();
+  const double fahrenheit = tableThermistor->readFahrenheit();
+
+  // Output of information
+  Serial.print("Temperature: ");
+  Serial.print(celsius);
+  Serial.print(" C, ");
+  Serial.print(kelvin);
+  Serial.print(" K, ");
+  Serial.print(fahrenheit);
+  Serial.println(" F");
+
+  delay(500); // optionally, only to delay the output of information in the example.
+}
+
+/**
+  Prints the table as a PROGMEM array.
+*/
+void printTable() {
+  float table[TABLE_SIZE];
+  tableThermistor->fillTable(table, TABLE_SIZE);
+  Serial.print("const float TABLE[");
+  Serial.print(TABLE_SIZE);
+  Serial.println("] PROGMEM = {");
+  for (int i = 0; i < TABLE_SIZE; ++i) {
+    Serial.print("  ");
+    Serial.print(table[i], 4);
+    Serial.println((i < TABLE_SIZE - 1) ? "," : "");
+  }
+  Serial.println("};");
+}
+
+/**
+  Returns the average time of a reading in microseconds.
+  Includes the time of analogRead().
+*/
+double benchmark(Thermistor* thermistor) {
+  volatile double sink = 0;
+  const unsigned long start = micros();
+  for (int i = 0; i < BENCHMARK_READINGS; ++i) {
+    sink = thermistor->readKelvin();
+  }
+  (void) sink;
+  return (double) (micros() - start) / BENCHMARK_READINGS;
+}
@@ -0,0 +1,132 @@
+/*
+  NTC Thermistor Models
+
+  Compares thermistor models of a 10K NTC thermistor,
+  built from its datasheet points: B-value (two points),
+  Steinhart-Hart (three points and least squares of all points)
+  and piecewise (all points). Prints the maximum error of each
+  model in -40...120 C against the Steinhart-Hart equation
+  of the thermistor, and the time of one conversion.
+
+  Then reads a temperature with the piecewise model
+  and displays it in the default Serial.
+
+  Also builds on a host (see NTC_Host.h).
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#include <Thermistor.h>
+#include <NTC_Thermistor.h>
+#include <BetaModel.h>
+#include <SteinhartHartModel.h>
+#include <PiecewiseModel.h>
+
+#define SENSOR_PIN             A1
+#define REFERENCE_RESISTANCE   10000
+
+/**
+  Datasheet points of the thermistor.
+*/
+#define POINTS_NUMBER 17
+const double CELSIUS[POINTS_NUMBER] = {
+  -40, -30, -20, -10, 0, 10, 20, 30, 40, 50, 60, 70, 80, 90, 100, 110, 120
+};
+const double RESISTANCES[POINTS_NUMBER] = {
+  205891.6, 119563.0, 71626.1, 44155.5, 27949.6, 18129.3, 12028.8, 8150.7,
+  5632.1, 3963.2, 2836.7, 2062.9, 1522.6, 1139.6, 864.1, 663.3, 515.1
+};
+
+/**
+  How many resistances are checked, in -40...120 C.
+*/
+#define SWEEP_POINTS 100
+
+// Steinhart-Hart equation the datasheet points are taken from.
+SteinhartHartModel reference(1.009249522e-3, 2.378405444e-4, 2.019202697e-7);
+
+PiecewiseModel piecewise(RESISTANCES, CELSIUS, POINTS_NUMBER);
+
+Thermistor* thermistor = NULL;
+
+// the setup function runs once when you press reset or power the board
+void setup() {
+  Serial.begin(9600);
+
+  // B25/80, points 25 C (interpolated) and 80 C
+  BetaModel beta = BetaModel::fit(referenceResistance(25), 25, RESISTANCES[12], 80);
+  const double THREE_RESISTANCES[] = { RESISTANCES[4], RESISTANCES[8], RESISTANCES[12] };
+  const double THREE_CELSIUS[] = { CELSIUS[4], CELSIUS[8], CELSIUS[12] };
+  SteinhartHartModel threePoints = SteinhartHartModel::fit(THREE_RESISTANCES, THREE_CELSIUS, 3);
+  SteinhartHartModel allPoints = SteinhartHartModel::fit(RESISTANCES, CELSIUS, POINTS_NUMBER);
+
+  Serial.println("model,max_error_c,ns_per_conversion");
+  compare("beta", &beta);
+  compare("steinhart_hart_3_points", &threePoints);
+  compare("steinhart_hart_least_squares", &allPoints);
+  compare("piecewise", &piecewise);
+
+  thermistor = new NTC_Thermistor(SENSOR_PIN, REFERENCE_RESISTANCE, &piecewise);
+}
+
+// the loop function runs over and over again forever
+void loop() {
+  // Reads temperature
+  const double celsius = thermistor->readCelsius();
+
+  // Output of information
+  Serial.print("Temperature: ");
+  Serial.print(celsius);
+  Serial.println(" C");
+
+  delay(500); // optionally, only to delay the output of information in the example.
+}
+
+/**
+  Resistance at the temperature, by the reference equation
+  (solved for the resistance by bisection).
+*/
+double referenceResistance(double celsius) {
+  double low = RESISTANCES[POINTS_NUMBER - 1] / 2;
+  double high = RESISTANCES[0] * 2;
+  for (int i = 0; i < 60; ++i) {
+    const double middle = sqrt(low * high);
+    if (reference.resistanceToKelvins(middle) - 273.15 > celsius) {
+      low = middle;
+    } else {
+      high = middle;
+    }
+  }
+  return sqrt(low * high);
+}
+
+/**
+  Prints the maximum error and the time of the model.
+*/
+void compare(const char* name, ThermistorModel* model) {
+  const double lowest = RESISTANCES[POINTS_NUMBER - 1];
+  const double ratio = RESISTANCES[0] / lowest;
+  double resistances[SWEEP_POINTS];
+  double maxError = 0;
+  for (int i = 0; i < SWEEP_POINTS; ++i) {
+    resistances[i] = lowest * pow(ratio, (double) i / (SWEEP_POINTS - 1));
+    const double error = abs(
+      model->resistanceToKelvins(resistances[i]) -
+      reference.resistanceToKelvins(resistances[i])
+    );
+    maxError = max(maxError, error);
+  }
+  volatile double sink;
+  const unsigned long start = micros();
+  for (int i = 0; i < SWEEP_POINTS; ++i) {
+    sink = model->resistanceToKelvins(resistances[i]);
+  }
+  const unsigned long time = micros() - start;
+  (void) sink;
+  Serial.print(name);
+  Serial.print(",");
+  Serial.print(maxError, 4);
+  Serial.print(",");
+  Serial.println(time * 1000.0 / SWEEP_POINTS, 1);
+}
@@ -0,0 +1,67 @@
+/*
+  Non-Blocking Average NTC Thermistor
+
+  Reads a temperature from the NTC 3950 thermistor
+  in the background of loop(), averages and displays it
+  in the default Serial, without blocking loop() by delay().
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#include <Thermistor.h>
+#include <NTC_Thermistor.h>
+#include <AverageThermistor.h>
+
+#define SENSOR_PIN             A1
+#define REFERENCE_RESISTANCE   8000
+#define NOMINAL_RESISTANCE     100000
+#define NOMINAL_TEMPERATURE    25
+#define B_VALUE                3950
+
+/**
+  How many readings are taken to determine a mean temperature.
+*/
+#define READINGS_NUMBER 10
+
+/**
+  Time between a temperature readings
+  from the temperature sensor (ms).
+*/
+#define DELAY_TIME 10
+
+AverageThermistor* thermistor = NULL;
+
+// the setup function runs once when you press reset or power the board
+void setup() {
+  Serial.begin(9600);
+
+  thermistor = new AverageThermistor(
+    new NTC_Thermistor(
+      SENSOR_PIN,
+      REFERENCE_RESISTANCE,
+      NOMINAL_RESISTANCE,
+      NOMINAL_TEMPERATURE,
+      B_VALUE
+    ),
+    READINGS_NUMBER,
+    DELAY_TIME
+  );
+}
+
+// the loop function runs over and over again forever
+void loop() {
+  // Takes a reading when it is time, returns immediately otherwise
+  if (thermistor->update()) {
+    // Output of information, once per a new average
+    Serial.print("Temperature: ");
+    Serial.print(thermistor->getCelsius());
+    Serial.print(" C, ");
+    Serial.print(thermistor->getKelvin());
+    Serial.print(" K, ");
+    Serial.print(thermistor->getFahrenheit());
+    Serial.println(" F");
+  }
+
+  // ... other work of the loop, never blocked by the thermistor
+}
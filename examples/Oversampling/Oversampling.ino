@@ -0,0 +1,139 @@
+/*
+  Oversampling of NTC Thermistor
+
+  Reads a temperature from the NTC 3950 thermistor
+  with 2 extra bits of resolution: 16 analog values
+  are summed and decimated, then converted once,
+  and displays it in the default Serial.
+
+  On start, compares AverageThermistor (averages temperatures,
+  one conversion per analog value) and OversamplingAdcSource
+  (averages analog values, one conversion per reading)
+  on scripted noisy analog values between two ADC steps:
+  analog values per reading, conversions per reading
+  and error to the temperature of the mean analog value.
+
+  Also builds on a host (see NTC_Host.h).
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#include <Thermistor.h>
+#include <NTC_Thermistor.h>
+#include <AverageThermistor.h>
+#include <AnalogAdcSource.h>
+#include <FakeAdcSource.h>
+#include <OversamplingAdcSource.h>
+
+#define SENSOR_PIN             A1
+#define REFERENCE_RESISTANCE   8000
+#define NOMINAL_RESISTANCE     100000
+#define NOMINAL_TEMPERATURE    25
+#define B_VALUE                3950
+#define ADC_RESOLUTION         1023
+
+/**
+  Scripted analog values: 75.3 with noise of +/-1.5,
+  64 values, so every compared reading takes whole periods.
+*/
+#define SIGNAL_LENGTH 64
+#define SIGNAL_ANALOG 75.3
+
+int signalValues[SIGNAL_LENGTH];
+
+Thermistor* thermistor = NULL;
+
+// the setup function runs once when you press reset or power the board
+void setup() {
+  Serial.begin(9600);
+
+  const double expected = makeSignal();
+  Serial.println("filter,values_per_reading,conversions_per_reading,error_c");
+  for (int bits = 1; bits <= 3; ++bits) {
+    const int values = 1 << (2 * bits);
+    FakeAdcSource averageSource(signalValues, SIGNAL_LENGTH);
+    Thermistor* average = new AverageThermistor(newSignalThermistor(&averageSource), values);
+    print("average", values, values, average->readCelsius() - expected);
+    delete average;
+
+    AdcSource* source = new OversamplingAdcSource(
+      new FakeAdcSource(signalValues, SIGNAL_LENGTH), bits
+    );
+    Thermistor* oversampling = newSignalThermistor(source);
+    print("oversampling", values, 1, oversampling->readCelsius() - expected);
+    delete oversampling;
+    delete source;
+  }
+
+  thermistor = new NTC_Thermistor(
+    new OversamplingAdcSource(new AnalogAdcSource(SENSOR_PIN), 2),
+    REFERENCE_RESISTANCE,
+    NOMINAL_RESISTANCE,
+    NOMINAL_TEMPERATURE,
+    B_VALUE,
+    ADC_RESOLUTION
+  );
+}
+
+// the loop function runs over and over again forever
+void loop() {
+  // Reads temperature
+  const double celsius = thermistor->readCelsius();
+
+  // Output of information
+  Serial.print("Temperature: ");
+  Serial.print(celsius);
+  Serial.println(" C");
+
+  delay(500); // optionally, only to delay the output of information in the example.
+}
+
+/**
+  Fills the scripted analog values,
+  noise by a linear congruential generator.
+
+  @return temperature in Celsius of the mean analog value
+*/
+double makeSignal() {
+  uint16_t random = 1;
+  long sum = 0;
+  for (int i = 0; i < SIGNAL_LENGTH; ++i) {
+    random = random * 25173 + 13849;
+    const double noise = (random >> 8) / 256.0 * 3 - 1.5;
+    signalValues[i] = (int) floor(SIGNAL_ANALOG + noise + 0.5);
+    sum += signalValues[i];
+  }
+  const double analog = (double) sum / SIGNAL_LENGTH;
+  const double resistance = REFERENCE_RESISTANCE / (ADC_RESOLUTION / analog - 1);
+  const double inverseKelvin = 1.0 / (NOMINAL_TEMPERATURE + 273.15) +
+    log(resistance / NOMINAL_RESISTANCE) / B_VALUE;
+  return (1.0 / inverseKelvin - 273.15);
+}
+
+/**
+  Returns a new thermistor that reads the source.
+*/
+Thermistor* newSignalThermistor(AdcSource* source) {
+  return new NTC_Thermistor(
+    source,
+    REFERENCE_RESISTANCE,
+    NOMINAL_RESISTANCE,
+    NOMINAL_TEMPERATURE,
+    B_VALUE,
+    ADC_RESOLUTION
+  );
+}
+
+/**
+  Prints a line of the comparison.
+*/
+void print(const char* name, int values, int conversions, double error) {
+  Serial.print(name);
+  Serial.print(",");
+  Serial.print(values);
+  Serial.print(",");
+  Serial.print(conversions);
+  Serial.print(",");
+  Serial.println(error, 4);
+}
@@ -35,10 +35,11 @@ void setup() {
 
 // the loop function runs over and over again forever
 void loop() {
-  // Reads temperature
-  const double celsius = thermistor->readCelsius();
-  const double kelvin = thermistor->readKelvin();
-  const double fahrenheit = thermistor->readFahrenheit();
+  // Reads temperature once, in all units
+  const ThermistorReading reading = thermistor->read();
+  const double celsius = reading.celsius;
+  const double kelvin = reading.kelvin;
+  const double fahrenheit = reading.fahrenheit;
 
   // Output of information
   Serial.print("Temperature: ");
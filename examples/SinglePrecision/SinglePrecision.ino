@@ -0,0 +1,156 @@
+/*
+  Single Precision NTC Thermistor
+
+  Reads a temperature from the NTC 3950 thermistor
+  and displays it in the default Serial.
+
+  On start, prints the type of the conversions (NTC_Scalar),
+  their maximum error against a conversion in double
+  over the analog values in -40...150 C range,
+  and the time of a conversion, with and without SmoothThermistor.
+
+  The library converts in double by default, in float with
+  the build flag -DNTC_SINGLE_PRECISION=1: faster on FPUs
+  of single precision only (Cortex-M4F, ESP32).
+  Build the example both ways to compare.
+
+  Also builds on a host (see NTC_Host.h).
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#include <Thermistor.h>
+#include <NTC_Thermistor.h>
+#include <SmoothThermistor.h>
+
+#define SENSOR_PIN             A1
+#define REFERENCE_RESISTANCE   8000
+#define NOMINAL_RESISTANCE     100000
+#define NOMINAL_TEMPERATURE    25
+#define B_VALUE                3950
+#define ANALOG_RESOLUTION      1023
+
+/**
+  How many times the analog range is timed.
+*/
+#define REPEATS 10
+
+/**
+  NTC thermistor that reads a given analog value
+  instead of the analog port, to sweep the ADC range.
+*/
+class SweepThermistor final : public NTC_Thermistor {
+  public:
+    int analog = 0;
+
+    SweepThermistor() : NTC_Thermistor(
+      SENSOR_PIN,
+      REFERENCE_RESISTANCE,
+      NOMINAL_RESISTANCE,
+      NOMINAL_TEMPERATURE,
+      B_VALUE,
+      ANALOG_RESOLUTION
+    ) {}
+
+  protected:
+    int readAnalog() override {
+      return analog;
+    }
+};
+
+Thermistor* thermistor = NULL;
+
+SweepThermistor* sweep = NULL;
+
+// the setup function runs once when you press reset or power the board
+void setup() {
+  Serial.begin(9600);
+
+  printPrecisionReport();
+
+  thermistor = new NTC_Thermistor(
+    SENSOR_PIN,
+    REFERENCE_RESISTANCE,
+    NOMINAL_RESISTANCE,
+    NOMINAL_TEMPERATURE,
+    B_VALUE,
+    ANALOG_RESOLUTION
+  );
+}
+
+// the loop function runs over and over again forever
+void loop() {
+  // Reads temperature
+  const NTC_Scalar celsius = thermistor->readCelsius();
+
+  // Output of information
+  Serial.print("Temperature: ");
+  Serial.print(celsius);
+  Serial.println(" C");
+
+  delay(500); // optionally, only to delay the output of information in the example.
+}
+
+/**
+  Compares the conversion of the library with one in double
+  for every analog value in -40...150 C range, and times it.
+*/
+void printPrecisionReport() {
+  sweep = new SweepThermistor();
+  double maxError = 0;
+  for (int analog = 1; analog < ANALOG_RESOLUTION; ++analog) {
+    sweep->analog = analog;
+    const double expected = expectedCelsius(analog);
+    if ((expected >= -40) && (expected <= 150)) {
+      const double error = sweep->readCelsius() - expected;
+      maxError = max(maxError, fabs(error));
+    }
+  }
+  Serial.print("Scalar: ");
+  Serial.print((sizeof(NTC_Scalar) == sizeof(float)) ? "float" : "double");
+  Serial.print(", ");
+  Serial.print((int) sizeof(NTC_Scalar));
+  Serial.println(" bytes");
+  Serial.print("Max error: ");
+  Serial.print(maxError, 5);
+  Serial.println(" C");
+  Serial.print("Conversion: ");
+  Serial.print(timeConversion(sweep), 3);
+  Serial.println(" us");
+
+  // SmoothThermistor deletes the sweep thermistor.
+  Thermistor* smooth = new SmoothThermistor(sweep, 5);
+  Serial.print("Smooth conversion: ");
+  Serial.print(timeConversion(smooth), 3);
+  Serial.println(" us");
+  delete smooth;
+  sweep = NULL;
+}
+
+/**
+  @return temperature in Celsius of the analog value, in double
+*/
+double expectedCelsius(int analog) {
+  const double resistance = REFERENCE_RESISTANCE / ((double) ANALOG_RESOLUTION / analog - 1);
+  const double inverseKelvin = 1.0 / (NOMINAL_TEMPERATURE + 273.15) +
+    log(resistance / NOMINAL_RESISTANCE) / B_VALUE;
+  return (1.0 / inverseKelvin - 273.15);
+}
+
+/**
+  @return time of one reading in microseconds
+*/
+double timeConversion(Thermistor* reader) {
+  volatile NTC_Scalar sink = 0;
+  const unsigned long start = micros();
+  for (int i = 0; i < REPEATS; ++i) {
+    for (int analog = 1; analog < ANALOG_RESOLUTION; ++analog) {
+      sweep->analog = analog;
+      sink = reader->readCelsius();
+    }
+  }
+  const unsigned long time = micros() - start;
+  (void) sink;
+  return (double) time / ((double) REPEATS * (ANALOG_RESOLUTION - 1));
+}
@@ -0,0 +1,142 @@
+/*
+  Spike Rejection of NTC Thermistor
+
+  Reads a temperature from the NTC 3950 thermistor, rejects
+  spikes (for example, of motor switching) by a median
+  of a burst of readings and displays it in the default Serial.
+
+  On start, compares AverageThermistor and MedianThermistor
+  on scripted analog values with noise and spikes:
+  readings per result, maximum error and time of a result
+  (the time of the average includes its delays between readings).
+
+  Also builds on a host (see NTC_Host.h).
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#include <Thermistor.h>
+#include <NTC_Thermistor.h>
+#include <AverageThermistor.h>
+#include <MedianThermistor.h>
+#include <FakeAdcSource.h>
+
+#define SENSOR_PIN             A1
+#define REFERENCE_RESISTANCE   8000
+#define NOMINAL_RESISTANCE     100000
+#define NOMINAL_TEMPERATURE    25
+#define B_VALUE                3950
+
+/**
+  Scripted analog values: 512 with noise of +/-2
+  and a spike to 1000 every SPIKE_PERIOD values.
+*/
+#define SIGNAL_LENGTH 64
+#define SIGNAL_ANALOG 512
+#define SPIKE_PERIOD 16
+
+/**
+  How many results are compared.
+*/
+#define RESULTS_NUMBER 50
+
+int signalValues[SIGNAL_LENGTH];
+
+Thermistor* thermistor = NULL;
+
+// the setup function runs once when you press reset or power the board
+void setup() {
+  Serial.begin(9600);
+
+  makeSignal();
+  Serial.println("filter,readings_per_result,max_error_c,us_per_result");
+  compare("average", 5, new AverageThermistor(newSignalThermistor(), 5));
+  compare("average", 10, new AverageThermistor(newSignalThermistor(), 10));
+  compare("average", 20, new AverageThermistor(newSignalThermistor(), 20));
+  compare("median", 3, new MedianThermistor<3>(newSignalThermistor()));
+  compare("median", 5, new MedianThermistor<5>(newSignalThermistor()));
+  compare("trimmed_mean_1", 5, new MedianThermistor<5, 1>(newSignalThermistor()));
+  compare("median", 9, new MedianThermistor<9>(newSignalThermistor()));
+
+  thermistor = new MedianThermistor<5>(
+    new NTC_Thermistor(
+      SENSOR_PIN,
+      REFERENCE_RESISTANCE,
+      NOMINAL_RESISTANCE,
+      NOMINAL_TEMPERATURE,
+      B_VALUE
+    )
+  );
+}
+
+// the loop function runs over and over again forever
+void loop() {
+  // Reads temperature
+  const double celsius = thermistor->readCelsius();
+
+  // Output of information
+  Serial.print("Temperature: ");
+  Serial.print(celsius);
+  Serial.println(" C");
+
+  delay(500); // optionally, only to delay the output of information in the example.
+}
+
+/**
+  Fills the scripted analog values,
+  noise by a linear congruential generator.
+*/
+void makeSignal() {
+  uint16_t random = 1;
+  for (int i = 0; i < SIGNAL_LENGTH; ++i) {
+    random = random * 25173 + 13849;
+    signalValues[i] = (i % SPIKE_PERIOD == SPIKE_PERIOD / 2) ?
+      1000 : SIGNAL_ANALOG + (int) (random >> 8) % 5 - 2;
+  }
+}
+
+/**
+  Returns a new thermistor that reads the scripted values.
+*/
+Thermistor* newSignalThermistor() {
+  return new NTC_Thermistor(
+    new FakeAdcSource(signalValues, SIGNAL_LENGTH),
+    REFERENCE_RESISTANCE,
+    NOMINAL_RESISTANCE,
+    NOMINAL_TEMPERATURE,
+    B_VALUE
+  );
+}
+
+/**
+  Prints the maximum error and the time of a result of the filter.
+*/
+void compare(const char* name, int readings, Thermistor* filter) {
+  const int SIGNAL_ANALOG_VALUE[] = { SIGNAL_ANALOG };
+  FakeAdcSource exactSource(SIGNAL_ANALOG_VALUE, 1);
+  NTC_Thermistor exact(
+    &exactSource,
+    REFERENCE_RESISTANCE,
+    NOMINAL_RESISTANCE,
+    NOMINAL_TEMPERATURE,
+    B_VALUE
+  );
+  const double expected = exact.readCelsius();
+  double maxError = 0;
+  const unsigned long start = micros();
+  for (int i = 0; i < RESULTS_NUMBER; ++i) {
+    // abs() and max() may be macros, so the reading is taken once
+    const double error = filter->readCelsius() - expected;
+    maxError = max(maxError, abs(error));
+  }
+  const unsigned long time = micros() - start;
+  Serial.print(name);
+  Serial.print(",");
+  Serial.print(readings);
+  Serial.print(",");
+  Serial.print(maxError, 3);
+  Serial.print(",");
+  Serial.println((double) time / RESULTS_NUMBER, 1);
+  delete filter;
+}
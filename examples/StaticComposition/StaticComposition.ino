@@ -0,0 +1,137 @@
+/*
+  Static Composition of NTC Thermistor
+
+  Reads a temperature from the NTC 3950 thermistor,
+  averages, smooths and displays it in the default Serial.
+  The class-wrappers are composed by value, without heap.
+
+  On start, prints the RAM used by the composition
+  by value and by "new" (AverageThermistor, SmoothThermistor),
+  and the time of a reading of both. Flash (program storage)
+  of both is printed by the Arduino IDE on compilation:
+  compile the sketch with and without USE_HEAP_COMPOSITION.
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#include <Thermistor.h>
+#include <NTC_Thermistor.h>
+#include <AverageThermistor.h>
+#include <SmoothThermistor.h>
+#include <StaticAverageThermistor.h>
+#include <StaticSmoothThermistor.h>
+#include <ThermistorAdapter.h>
+
+#define SENSOR_PIN             A1
+#define REFERENCE_RESISTANCE   8000
+#define NOMINAL_RESISTANCE     100000
+#define NOMINAL_TEMPERATURE    25
+#define B_VALUE                3950
+
+#define READINGS_NUMBER 10
+#define DELAY_TIME 1
+#define SMOOTHING_FACTOR 5
+
+/**
+  Comment out to leave the heap composition
+  out of the sketch and compare flash usage.
+*/
+#define USE_HEAP_COMPOSITION
+
+/**
+  How many readings are timed.
+*/
+#define BENCHMARK_READINGS 100
+
+// Smoothing of average temperatures, by value.
+StaticSmoothThermistor<
+  StaticAverageThermistor<NTC_Thermistor, READINGS_NUMBER, DELAY_TIME>,
+  SMOOTHING_FACTOR
+> thermistor(
+  SENSOR_PIN,
+  REFERENCE_RESISTANCE,
+  NOMINAL_RESISTANCE,
+  NOMINAL_TEMPERATURE,
+  B_VALUE
+);
+
+// the setup function runs once when you press reset or power the board
+void setup() {
+  Serial.begin(9600);
+
+  Serial.print("By value: ");
+  Serial.print((int) sizeof(thermistor));
+  Serial.print(" bytes, ");
+  Serial.print(benchmarkStatic());
+  Serial.println(" us/reading");
+
+#if defined(USE_HEAP_COMPOSITION)
+  Thermistor* heapThermistor = new SmoothThermistor(
+    new AverageThermistor(
+      new NTC_Thermistor(
+        SENSOR_PIN,
+        REFERENCE_RESISTANCE,
+        NOMINAL_RESISTANCE,
+        NOMINAL_TEMPERATURE,
+        B_VALUE
+      ),
+      READINGS_NUMBER,
+      DELAY_TIME
+    ),
+    SMOOTHING_FACTOR
+  );
+  Serial.print("By new: ");
+  // plus the pointer, without heap bookkeeping (2 bytes per block on AVR)
+  Serial.print((int) (sizeof(NTC_Thermistor) + sizeof(AverageThermistor) +
+    sizeof(SmoothThermistor) + sizeof(Thermistor*)));
+  Serial.print(" bytes, ");
+  Serial.print(benchmark(heapThermistor));
+  Serial.println(" us/reading");
+  delete heapThermistor;
+#endif
+}
+
+// the loop function runs over and over again forever
+void loop() {
+  // Reads temperature once, in all units
+  const ThermistorReading reading = thermistor.read();
+
+  // Output of information
+  Serial.print("Temperature: ");
+  Serial.print(reading.celsius);
+  Serial.print(" C, ");
+  Serial.print(reading.kelvin);
+  Serial.print(" K, ");
+  Serial.print(reading.fahrenheit);
+  Serial.println(" F");
+
+  delay(500); // optionally, only to delay the output of information in the example.
+}
+
+/**
+  Returns the average time of a reading by value in microseconds.
+*/
+double benchmarkStatic() {
+  volatile double sink;
+  const unsigned long start = micros();
+  for (int i = 0; i < BENCHMARK_READINGS; ++i) {
+    sink = thermistor.readCelsius();
+  }
+  (void) sink;
+  return (double) (micros() - start) / BENCHMARK_READINGS;
+}
+
+/**
+  Returns the average time of a reading through
+  the Thermistor interface in microseconds.
+*/
+double benchmark(Thermistor* thermistor) {
+  volatile double sink;
+  const unsigned long start = micros();
+  for (int i = 0; i < BENCHMARK_READINGS; ++i) {
+    sink = thermistor->readCelsius();
+  }
+  (void) sink;
+  return (double) (micros() - start) / BENCHMARK_READINGS;
+}
@@ -0,0 +1,158 @@
+/*
+  Supply Compensation of NTC Thermistor
+
+  Reads a temperature from the NTC 3950 thermistor
+  corrected for a sagging supply of the divider
+  by a reference channel - a 1:2 divider of the supply
+  on REFERENCE_PIN, read once per 16 readings,
+  and displays it in the default Serial.
+
+  On start, compares the thermistor with and without
+  the correction on scripted analog values of a 12-bit ADC
+  with a fixed reference (e.g. ESP32), while the supply
+  of the divider sags from 3.3 V to 3.0 V at 25 C:
+  supply, error without and with the correction
+  and reference readings per thermistor reading.
+
+  Also builds on a host (see NTC_Host.h).
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#include <Thermistor.h>
+#include <NTC_Thermistor.h>
+#include <AnalogAdcSource.h>
+#include <FakeAdcSource.h>
+#include <RatiometricAdcSource.h>
+
+#define SENSOR_PIN             A1
+#define REFERENCE_PIN          A2
+#define REFERENCE_RESISTANCE   8000
+#define NOMINAL_RESISTANCE     100000
+#define NOMINAL_TEMPERATURE    25
+#define B_VALUE                3950
+#define ADC_RESOLUTION         4095
+
+/**
+  Nominal supply of the divider and the ADC reference (V).
+*/
+#define NOMINAL_SUPPLY 3.3
+
+/**
+  Analog value of the 1:2 divider of the supply at the nominal supply.
+*/
+#define REFERENCE_NOMINAL 2048
+
+/**
+  Thermistor readings between the reference readings.
+*/
+#define REFRESH_PERIOD 16
+
+/**
+  Scripted supply steps, REFRESH_PERIOD thermistor readings each.
+*/
+#define STEPS 4
+
+int thermistorValues[STEPS * REFRESH_PERIOD];
+int referenceValues[STEPS];
+double supplies[STEPS];
+
+Thermistor* thermistor = NULL;
+
+// the setup function runs once when you press reset or power the board
+void setup() {
+  Serial.begin(9600);
+
+  makeSignal();
+  FakeAdcSource* plainSource = new FakeAdcSource(thermistorValues, STEPS * REFRESH_PERIOD);
+  FakeAdcSource* referenceSource = new FakeAdcSource(referenceValues, STEPS);
+  AdcSource* compensatedSource = new RatiometricAdcSource(
+    new FakeAdcSource(thermistorValues, STEPS * REFRESH_PERIOD),
+    referenceSource,
+    REFERENCE_NOMINAL,
+    REFRESH_PERIOD
+  );
+  Thermistor* plain = newThermistor(plainSource);
+  Thermistor* compensated = newThermistor(compensatedSource);
+
+  Serial.println("supply_v,error_c,compensated_error_c,reference_reads_per_reading");
+  for (int step = 0; step < STEPS; ++step) {
+    double error = 0;
+    double compensatedError = 0;
+    for (int i = 0; i < REFRESH_PERIOD; ++i) {
+      error += plain->readCelsius() - NOMINAL_TEMPERATURE;
+      compensatedError += compensated->readCelsius() - NOMINAL_TEMPERATURE;
+    }
+    Serial.print(supplies[step], 2);
+    Serial.print(",");
+    Serial.print(error / REFRESH_PERIOD, 3);
+    Serial.print(",");
+    Serial.print(compensatedError / REFRESH_PERIOD, 3);
+    Serial.print(",");
+    Serial.println((double) referenceSource->getReadingsCount() / ((step + 1) * REFRESH_PERIOD), 4);
+  }
+  delete plain;
+  delete compensated;
+  delete plainSource;
+  delete compensatedSource;
+
+  thermistor = new NTC_Thermistor(
+    new RatiometricAdcSource(
+      new AnalogAdcSource(SENSOR_PIN),
+      new AnalogAdcSource(REFERENCE_PIN),
+      REFERENCE_NOMINAL,
+      REFRESH_PERIOD
+    ),
+    REFERENCE_RESISTANCE,
+    NOMINAL_RESISTANCE,
+    NOMINAL_TEMPERATURE,
+    B_VALUE,
+    ADC_RESOLUTION
+  );
+}
+
+// the loop function runs over and over again forever
+void loop() {
+  // Reads temperature
+  const double celsius = thermistor->readCelsius();
+
+  // Output of information
+  Serial.print("Temperature: ");
+  Serial.print(celsius);
+  Serial.println(" C");
+
+  delay(500); // optionally, only to delay the output of information in the example.
+}
+
+/**
+  Fills the scripted analog values of the thermistor at 25 C
+  and of the 1:2 divider of the supply, read against
+  the fixed ADC reference of NOMINAL_SUPPLY.
+*/
+void makeSignal() {
+  for (int step = 0; step < STEPS; ++step) {
+    supplies[step] = NOMINAL_SUPPLY - 0.1 * step;
+    const double ratio = supplies[step] / NOMINAL_SUPPLY;
+    const double analog = (double) ADC_RESOLUTION * NOMINAL_RESISTANCE /
+      (REFERENCE_RESISTANCE + NOMINAL_RESISTANCE) * ratio;
+    for (int i = 0; i < REFRESH_PERIOD; ++i) {
+      thermistorValues[step * REFRESH_PERIOD + i] = (int) floor(analog + 0.5);
+    }
+    referenceValues[step] = (int) floor(REFERENCE_NOMINAL * ratio + 0.5);
+  }
+}
+
+/**
+  Returns a new thermistor that reads the source.
+*/
+Thermistor* newThermistor(AdcSource* source) {
+  return new NTC_Thermistor(
+    source,
+    REFERENCE_RESISTANCE,
+    NOMINAL_RESISTANCE,
+    NOMINAL_TEMPERATURE,
+    B_VALUE,
+    ADC_RESOLUTION
+  );
+}
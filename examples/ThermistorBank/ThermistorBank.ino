@@ -0,0 +1,109 @@
+/*
+  NTC Thermistor Bank
+
+  Reads temperatures from several NTC 3950 thermistors
+  in one pass and displays them in the default Serial.
+
+  On start, compares the time of reading all channels
+  by the bank and by separate NTC_Thermistor instances.
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#include <Thermistor.h>
+#include <NTC_Thermistor.h>
+#include <ThermistorBank.h>
+
+#define CHANNELS               4
+#define REFERENCE_RESISTANCE   8000
+#define NOMINAL_RESISTANCE     100000
+#define NOMINAL_TEMPERATURE    25
+#define B_VALUE                3950
+
+/**
+  How many scans are timed in the benchmark.
+*/
+#define BENCHMARK_SCANS 100
+
+const int SENSOR_PINS[CHANNELS] = { A0, A1, A2, A3 };
+
+ThermistorBank<CHANNELS> bank;
+
+// the setup function runs once when you press reset or power the board
+void setup() {
+  Serial.begin(9600);
+
+  for (int i = 0; i < CHANNELS; ++i) {
+    bank.addChannel(
+      SENSOR_PINS[i],
+      REFERENCE_RESISTANCE,
+      NOMINAL_RESISTANCE,
+      NOMINAL_TEMPERATURE,
+      B_VALUE
+    );
+  }
+
+  benchmark();
+}
+
+// the loop function runs over and over again forever
+void loop() {
+  // Reads temperatures of all channels
+  NTC_Scalar celsius[CHANNELS];
+  bank.readCelsius(celsius);
+
+  // Output of information
+  for (int i = 0; i < CHANNELS; ++i) {
+    Serial.print("Temperature ");
+    Serial.print(i);
+    Serial.print(": ");
+    Serial.print(celsius[i]);
+    Serial.println(" C");
+  }
+
+  delay(500); // optionally, only to delay the output of information in the example.
+}
+
+/**
+  Prints the average time of reading all channels
+  in microseconds, by the bank and by separate instances.
+*/
+void benchmark() {
+  Thermistor* thermistors[CHANNELS];
+  for (int i = 0; i < CHANNELS; ++i) {
+    thermistors[i] = new NTC_Thermistor(
+      SENSOR_PINS[i],
+      REFERENCE_RESISTANCE,
+      NOMINAL_RESISTANCE,
+      NOMINAL_TEMPERATURE,
+      B_VALUE
+    );
+  }
+  NTC_Scalar kelvins[CHANNELS];
+
+  unsigned long start = micros();
+  for (int scan = 0; scan < BENCHMARK_SCANS; ++scan) {
+    for (int i = 0; i < CHANNELS; ++i) {
+      kelvins[i] = thermistors[i]->readKelvin();
+    }
+  }
+  const unsigned long instancesTime = micros() - start;
+
+  start = micros();
+  for (int scan = 0; scan < BENCHMARK_SCANS; ++scan) {
+    bank.readKelvin(kelvins);
+  }
+  const unsigned long bankTime = micros() - start;
+
+  Serial.print("Instances: ");
+  Serial.print((double) instancesTime / BENCHMARK_SCANS);
+  Serial.println(" us/scan");
+  Serial.print("Bank: ");
+  Serial.print((double) bankTime / BENCHMARK_SCANS);
+  Serial.println(" us/scan");
+
+  for (int i = 0; i < CHANNELS; ++i) {
+    delete thermistors[i];
+  }
+}
@@ -0,0 +1,99 @@
+/*
+  Threshold Events of NTC Thermistor
+
+  Watches the NTC 3950 thermistor for crossing of 40 C and 60 C
+  with 2 C of hysteresis and displays the entered band
+  in the default Serial, only when it is changed.
+  Between the events, a reading is one analog value
+  compared with precomputed analog thresholds,
+  no conversion into a temperature.
+
+  On a host, the scripted analog values warm
+  the thermistor from 25 C up to 70 C and back,
+  with noise at the thresholds.
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#include <Thermistor.h>
+#include <NTC_Thermistor.h>
+#include <ThresholdThermistor.h>
+
+#define SENSOR_PIN             A1
+#define REFERENCE_RESISTANCE   8000
+#define NOMINAL_RESISTANCE     100000
+#define NOMINAL_TEMPERATURE    25
+#define B_VALUE                3950
+
+/**
+  Thresholds and their hysteresis (Celsius).
+*/
+#define WARM_THRESHOLD 40
+#define HOT_THRESHOLD  60
+#define HYSTERESIS     2
+
+/**
+  Time between readings (ms).
+*/
+#define DELAY_TIME 100
+
+const char* const BANDS[] = { "normal", "warm", "hot" };
+
+ThresholdThermistor<2>* thermistor = NULL;
+
+// the setup function runs once when you press reset or power the board
+void setup() {
+  Serial.begin(9600);
+
+#ifndef ARDUINO
+  // Host build: 25 C -> 70 C -> 25 C, with noise of +/-1 analog value.
+  static int analogValues[182];
+  for (int i = 0; i < 91; ++i) {
+    const double celsius = 25 + i / 2.0;
+    const double resistance = NOMINAL_RESISTANCE *
+      exp(B_VALUE * (1 / (celsius + 273.15) - 1 / (NOMINAL_TEMPERATURE + 273.15)));
+    const int analog = (int) floor(1023 * resistance / (resistance + REFERENCE_RESISTANCE) + 0.5);
+    const int noise = (i % 3) - 1;
+    analogValues[i] = analog + noise;
+    analogValues[181 - i] = analog - noise;
+  }
+  NTC_Host::setAnalogValues(SENSOR_PIN, analogValues, 182);
+#endif
+
+  thermistor = new ThresholdThermistor<2>(
+    SENSOR_PIN,
+    REFERENCE_RESISTANCE,
+    NOMINAL_RESISTANCE,
+    NOMINAL_TEMPERATURE,
+    B_VALUE
+  );
+  thermistor->addThreshold(WARM_THRESHOLD, HYSTERESIS);
+  thermistor->addThreshold(HOT_THRESHOLD, HYSTERESIS);
+  thermistor->onBandChange(onBandChange);
+}
+
+// the loop function runs over and over again forever
+void loop() {
+  // Reads one analog value, calls back only when the band is changed
+  thermistor->update();
+
+  delay(DELAY_TIME);
+}
+
+/**
+  Called by update() when the band is changed,
+  the only place where the temperature is converted.
+*/
+void onBandChange(int band, int previousBand) {
+  if (previousBand >= 0) {
+    Serial.print("Left ");
+    Serial.print(BANDS[previousBand]);
+    Serial.print(", ");
+  }
+  Serial.print("entered ");
+  Serial.print(BANDS[band]);
+  Serial.print(" at ");
+  Serial.print(thermistor->getCelsius());
+  Serial.println(" C");
+}
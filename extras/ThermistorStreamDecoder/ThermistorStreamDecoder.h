@@ -0,0 +1,215 @@
+/**
+  ThermistorStreamDecoder - decoder of frames of ThermistorStream
+  (see src/ThermistorFrame.h) on a host (Linux, macOS, Windows),
+  C++11, header only.
+
+  Bytes are given as they come (a serial port, a file),
+  in chunks of any size; a frame cut between two chunks
+  is decoded with the next chunk. Frames with a wrong CRC
+  and bytes between frames are skipped, the decoder finds
+  the next SYNC byte. Differences of temperatures (DELTA frames)
+  of a channel are skipped until a full temperature of the channel,
+  at the start and after skipped bytes: a corrupted or cut frame
+  may have carried a difference of any channel.
+
+  Usage:
+  ThermistorStreamDecoder decoder;
+  decoder.decode(bytes, length, [](const ThermistorSample& sample) {
+    // sample.time, sample.channel, sample.analog or sample.centiCelsius
+    // (ThermistorSample::NO_CENTI_CELSIUS if unknown)
+  });
+
+  CLI: ntc_decode.cpp.
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef THERMISTOR_STREAM_DECODER_H
+#define THERMISTOR_STREAM_DECODER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <functional>
+#include <vector>
+#include "../../src/ThermistorFrame.h"
+
+/**
+  A decoded value of a channel.
+*/
+struct ThermistorSample {
+  uint32_t time;        // time (ms), restored from 16 bits of the frames.
+  int channel;
+  bool raw;             // true - analog value, false - temperature.
+  uint16_t analog;      // analog value of a RAW frame.
+  int32_t centiCelsius; // temperature in hundredths of degree Celsius,
+                        // NO_CENTI_CELSIUS if the temperature is unknown.
+
+  // Unknown temperature, as NTC_NO_CENTI_CELSIUS of the library.
+  static const int32_t NO_CENTI_CELSIUS = INT32_MIN;
+};
+
+class ThermistorStreamDecoder final {
+
+  public:
+    typedef std::function<void(const ThermistorSample& sample)> SampleCallback;
+
+  private:
+    // Channel numbers are bytes.
+    static const int CHANNELS = 256;
+
+    std::vector<uint8_t> buffer;
+    int32_t previous[CHANNELS] = {};
+    bool known[CHANNELS] = {};
+    bool timed = false;
+    uint32_t time = 0;
+    unsigned long frames = 0;
+    unsigned long errors = 0;
+    unsigned long skippedBytes = 0;
+    unsigned long skippedValues = 0;
+
+  public:
+    /**
+      Decodes the bytes, calls back for each value
+      of each complete frame.
+
+      @param data - bytes to decode (not NULL)
+      @param length - number of bytes
+      @param callback - function to call for a value
+      @return number of values
+    */
+    int decode(const uint8_t* data, const size_t length, const SampleCallback& callback) {
+      this->buffer.insert(this->buffer.end(), data, data + length);
+      size_t position = 0;
+      int samples = 0;
+      while (true) {
+        // Bytes before the SYNC byte.
+        while ((position < this->buffer.size()) && (this->buffer[position] != ThermistorFrame::SYNC)) {
+          ++position;
+          skip();
+        }
+        if (this->buffer.size() - position < (size_t) ThermistorFrame::HEADER_SIZE) {
+          break;
+        }
+        const uint8_t* frame = this->buffer.data() + position;
+        const int valueSize = ThermistorFrame::valueSize(frame[1]);
+        const int count = frame[3];
+        if ((valueSize == 0) || (count < 1) || (count > ThermistorFrame::MAX_COUNT)) {
+          // Not a header, the SYNC byte is a part of data.
+          ++position;
+          skip();
+          continue;
+        }
+        const size_t size = ThermistorFrame::HEADER_SIZE + valueSize * count + 1;
+        if (this->buffer.size() - position < size) {
+          break;
+        }
+        if (ThermistorFrame::crc8(frame + 1, (int) size - 2) != frame[size - 1]) {
+          ++position;
+          ++this->errors;
+          skip();
+          continue;
+        }
+        samples += decodeFrame(frame, count, callback);
+        position += size;
+      }
+      this->buffer.erase(this->buffer.begin(), this->buffer.begin() + position);
+      return samples;
+    }
+
+    /**
+      @return number of decoded frames
+    */
+    unsigned long getFrames() const {
+      return this->frames;
+    }
+
+    /**
+      @return number of frames with a wrong CRC
+    */
+    unsigned long getErrors() const {
+      return this->errors;
+    }
+
+    /**
+      @return number of bytes skipped between frames
+      (including the SYNC bytes of frames with a wrong CRC)
+    */
+    unsigned long getSkippedBytes() const {
+      return this->skippedBytes;
+    }
+
+    /**
+      @return number of differences skipped
+      before a full temperature of their channels
+    */
+    unsigned long getSkippedValues() const {
+      return this->skippedValues;
+    }
+
+  private:
+    /**
+      Skips a byte: the previous temperatures
+      of all channels are unknown from now on.
+    */
+    void skip() {
+      ++this->skippedBytes;
+      for (int i = 0; i < CHANNELS; ++i) {
+        this->known[i] = false;
+      }
+    }
+
+    /**
+      Decodes a frame with a valid CRC.
+
+      @return number of values
+    */
+    int decodeFrame(const uint8_t* frame, const int count, const SampleCallback& callback) {
+      const uint16_t frameTime = (uint16_t) (frame[4] | (frame[5] << 8));
+      // Restores the wrapped time from the previous frame.
+      this->time = this->timed ? this->time + (uint16_t) (frameTime - (uint16_t) this->time) : frameTime;
+      this->timed = true;
+      ++this->frames;
+
+      const uint8_t type = frame[1];
+      const uint8_t* value = frame + ThermistorFrame::HEADER_SIZE;
+      int samples = 0;
+      for (int i = 0; i < count; ++i) {
+        const int channel = frame[2] + i;
+        ThermistorSample sample = { this->time, channel, type == ThermistorFrame::RAW, 0, 0 };
+        if (type == ThermistorFrame::DELTA) {
+          const int8_t difference = (int8_t) *value++;
+          if ((channel >= CHANNELS) || !this->known[channel]) {
+            ++this->skippedValues;
+            continue;
+          }
+          sample.centiCelsius = this->previous[channel] += difference;
+        } else {
+          const uint16_t word = (uint16_t) (value[0] | (value[1] << 8));
+          value += 2;
+          if (channel >= CHANNELS) {
+            ++this->skippedValues;
+            continue;
+          }
+          if (sample.raw) {
+            sample.analog = word;
+          } else if ((int16_t) word == ThermistorFrame::NO_CENTI_CELSIUS) {
+            // No difference follows an unknown temperature.
+            sample.centiCelsius = ThermistorSample::NO_CENTI_CELSIUS;
+            this->known[channel] = false;
+          } else {
+            sample.centiCelsius = this->previous[channel] = (int16_t) word;
+            this->known[channel] = true;
+          }
+        }
+        callback(sample);
+        ++samples;
+      }
+      return samples;
+    }
+};
+
+#endif
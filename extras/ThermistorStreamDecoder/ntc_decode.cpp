@@ -0,0 +1,105 @@
+/**
+  ntc_decode - prints frames of ThermistorStream as CSV:
+  time_ms,channel,analog,celsius
+
+  Analog values of RAW frames are converted into Celsius
+  by the B-value equation, if the parameters are given
+  (as of NTC_Thermistor).
+
+  Build:
+  g++ -std=c++11 -O2 -o ntc_decode ntc_decode.cpp
+
+  Usage:
+  ntc_decode [-b R0 Rn Tn B ADC] [FILE]
+  Reads the standard input without FILE, for example, a serial port:
+  stty -F /dev/ttyUSB0 115200 raw && ntc_decode < /dev/ttyUSB0
+
+  Where,
+  R0 - reference resistance,
+  Rn - nominal resistance,
+  Tn - nominal temperature in Celsius,
+  B - b-value of a thermistor,
+  ADC - ADC resolution (1023, for Arduino).
+
+  Statistics (frames, CRC errors, skipped bytes and values)
+  are printed into the standard error at the end.
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ThermistorStreamDecoder.h"
+
+int main(int argc, char* argv[]) {
+  bool convert = false;
+  double referenceResistance = 0;
+  double nominalResistance = 0;
+  double nominalKelvin = 0;
+  double bValue = 0;
+  double adcResolution = 0;
+  const char* path = NULL;
+  for (int i = 1; i < argc; ++i) {
+    if ((strcmp(argv[i], "-b") == 0) && (i + 5 < argc)) {
+      convert = true;
+      referenceResistance = atof(argv[++i]);
+      nominalResistance = atof(argv[++i]);
+      nominalKelvin = atof(argv[++i]) + 273.15;
+      bValue = atof(argv[++i]);
+      adcResolution = atof(argv[++i]);
+    } else if ((argv[i][0] == '-') && (argv[i][1] != '\0')) {
+      fprintf(stderr, "usage: %s [-b R0 Rn Tn B ADC] [FILE]\n", argv[0]);
+      return 2;
+    } else {
+      path = argv[i];
+    }
+  }
+
+  FILE* input = ((path == NULL) || (strcmp(path, "-") == 0)) ? stdin : fopen(path, "rb");
+  if (input == NULL) {
+    perror(path);
+    return 1;
+  }
+
+  ThermistorStreamDecoder decoder;
+  unsigned long samples = 0;
+  unsigned long bytes = 0;
+  printf("time_ms,channel,analog,celsius\n");
+  const ThermistorStreamDecoder::SampleCallback print = [&](const ThermistorSample& sample) {
+    if (!sample.raw && (sample.centiCelsius == ThermistorSample::NO_CENTI_CELSIUS)) {
+      printf("%lu,%d,,\n", (unsigned long) sample.time, sample.channel);
+    } else if (!sample.raw) {
+      printf("%lu,%d,,%.2f\n", (unsigned long) sample.time, sample.channel, sample.centiCelsius / 100.0);
+    } else if (convert && (sample.analog > 0) && (sample.analog < adcResolution)) {
+      const double resistance = referenceResistance / (adcResolution / sample.analog - 1);
+      const double kelvin = 1 / (1 / nominalKelvin + log(resistance / nominalResistance) / bValue);
+      printf("%lu,%d,%u,%.2f\n", (unsigned long) sample.time, sample.channel, sample.analog, kelvin - 273.15);
+    } else {
+      printf("%lu,%d,%u,\n", (unsigned long) sample.time, sample.channel, sample.analog);
+    }
+  };
+
+  uint8_t chunk[4096];
+  size_t length;
+  while ((length = fread(chunk, 1, sizeof(chunk), input)) > 0) {
+    bytes += length;
+    samples += decoder.decode(chunk, length, print);
+  }
+  if (input != stdin) {
+    fclose(input);
+  }
+
+  fprintf(
+    stderr,
+    "bytes: %lu, frames: %lu, values: %lu, crc errors: %lu, skipped bytes: %lu, skipped values: %lu\n",
+    bytes, decoder.getFrames(), samples, decoder.getErrors(),
+    decoder.getSkippedBytes(), decoder.getSkippedValues()
+  );
+  return 0;
+}
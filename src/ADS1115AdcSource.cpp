@@ -0,0 +1,49 @@
+/**
+  Released into the public domain.
+*/
+#include "ADS1115AdcSource.h"
+
+#if defined(ARDUINO)
+
+ADS1115AdcSource::ADS1115AdcSource(
+  const uint8_t channel,
+  const uint8_t address,
+  const uint16_t gain,
+  TwoWire* wire
+) {
+  this->wire = wire;
+  this->address = address;
+  this->config = CONFIG_OS | (CONFIG_MUX_AIN0 + ((channel & 0x03) << 12)) |
+    gain | CONFIG_SINGLE_860SPS;
+}
+
+int ADS1115AdcSource::read() {
+  writeRegister(CONFIG_REGISTER, this->config);
+  for (int i = 0; i < MAX_POLLS; ++i) {
+    if (readRegister(CONFIG_REGISTER) & CONFIG_OS) {
+      const int16_t value = (int16_t) readRegister(CONVERSION_REGISTER);
+      return max(value, (int16_t) 0);
+    }
+  }
+  return 0;
+}
+
+inline void ADS1115AdcSource::writeRegister(const uint8_t reg, const uint16_t value) {
+  this->wire->beginTransmission(this->address);
+  this->wire->write(reg);
+  this->wire->write((uint8_t) (value >> 8));
+  this->wire->write((uint8_t) (value & 0xFF));
+  this->wire->endTransmission();
+}
+
+inline uint16_t ADS1115AdcSource::readRegister(const uint8_t reg) {
+  this->wire->beginTransmission(this->address);
+  this->wire->write(reg);
+  this->wire->endTransmission();
+  if (this->wire->requestFrom(this->address, (uint8_t) 2) != 2) {
+    return 0;
+  }
+  const uint16_t high = this->wire->read();
+  return (high << 8) | this->wire->read();
+}
+#endif
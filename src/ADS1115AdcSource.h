@@ -0,0 +1,95 @@
+/**
+  ADS1115AdcSource - analog values of a single-ended input
+  of the external ADS1115 16-bit I2C ADC (single-shot mode).
+
+  The result is 0...32767 for 0...full scale voltage
+  of the chosen gain. The thermistor ADC resolution is the
+  divider supply voltage in the result units, for example,
+  3.3 V supply with 4.096 V full scale: 32767 * 3.3 / 4.096 = 26400.
+
+  Instantiation:
+  Wire.begin();
+  AdcSource* source = new ADS1115AdcSource(0); // AIN0, address 0x48
+  Thermistor* thermistor = new NTC_Thermistor(
+    source, 8000, 100000, 25, 3950, 26400
+  );
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef ADS1115_ADC_SOURCE_H
+#define ADS1115_ADC_SOURCE_H
+
+// Needs the Wire library, not available on a host.
+#if defined(ARDUINO)
+
+#include <Wire.h>
+#include "AdcSource.h"
+
+class ADS1115AdcSource final : public AdcSource {
+
+  public:
+    // Default I2C address (ADDR pin to GND).
+    static const uint8_t DEFAULT_ADDRESS = 0x48;
+    // Full scale voltage: +/-4.096 V.
+    static const uint16_t GAIN_4_096V = 0x0200;
+    // Full scale voltage: +/-2.048 V.
+    static const uint16_t GAIN_2_048V = 0x0400;
+
+  private:
+    static const uint8_t CONVERSION_REGISTER = 0x00;
+    static const uint8_t CONFIG_REGISTER = 0x01;
+    // Start a single conversion / conversion is done.
+    static const uint16_t CONFIG_OS = 0x8000;
+    // Single-ended AIN0, AIN1..3 are next.
+    static const uint16_t CONFIG_MUX_AIN0 = 0x4000;
+    // Single-shot mode, 860 SPS, comparator disabled.
+    static const uint16_t CONFIG_SINGLE_860SPS = 0x01E3;
+    // Maximum number of polls of a conversion.
+    static const int MAX_POLLS = 100;
+
+    TwoWire* wire;
+    uint8_t address;
+    uint16_t config;
+
+  public:
+    /**
+      Constructor
+
+      @param channel - single-ended input (0...3)
+      @param address - I2C address (default, 0x48)
+      @param gain - full scale voltage (default, GAIN_4_096V)
+      @param wire - I2C bus, begun by the sketch (default, Wire)
+    */
+    ADS1115AdcSource(
+      uint8_t channel,
+      uint8_t address = DEFAULT_ADDRESS,
+      uint16_t gain = GAIN_4_096V,
+      TwoWire* wire = &Wire
+    );
+
+    /**
+      Starts a conversion, waits for it and reads the result.
+
+      @return analog value (0...32767), 0 on I2C failure
+    */
+    int read() override;
+
+  private:
+    /**
+      Writes a 16-bit register.
+    */
+    inline void writeRegister(uint8_t reg, uint16_t value);
+
+    /**
+      Reads a 16-bit register.
+    */
+    inline uint16_t readRegister(uint8_t reg);
+};
+
+#endif // ARDUINO
+#endif
@@ -0,0 +1,85 @@
+/**
+  AdcSource - interface describes a source
+  of analog values for a thermistor.
+
+  NTC_Thermistor reads its analog port by analogRead()
+  unless an AdcSource is given in the constructor:
+  Thermistor* thermistor = new NTC_Thermistor(
+    SOURCE, 8000, 100000, 25, 3950
+  );
+
+  Implementations:
+  AnalogAdcSource - analogRead() of an analog port;
+  MilliVoltAdcSource - calibrated analogReadMilliVolts() (ESP32);
+  BandgapAdcSource - the internal bandgap (AVR);
+  DmaAdcSource - buffer filled by DMA or continuous conversion;
+  ADS1115AdcSource - external I2C ADC;
+  FakeAdcSource - scripted values, for tests without hardware;
+  SmoothAdcSource - integer exponential smoothing of a source;
+  OversamplingAdcSource - extra bits of a source by oversampling;
+  RatiometricAdcSource - a source corrected by a reference channel.
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef ADC_SOURCE_H
+#define ADC_SOURCE_H
+
+#if defined(ARDUINO) && (ARDUINO >= 100)
+  #include <Arduino.h>
+#elif defined(ARDUINO)
+  #include <WProgram.h>
+#else
+  #include "NTC_Host.h"
+#endif
+
+class AdcSource {
+
+  public:
+
+    /**
+      Destructor
+      Deletes AdcSource instance.
+    */
+    virtual ~AdcSource() {};
+
+    /**
+      Reads an analog value.
+
+      @return analog value (0...ADC resolution)
+    */
+    virtual int read() = 0;
+
+    /**
+      Reads several analog values into the buffer.
+      By default, calls read() for each value,
+      implementations may read faster in a burst.
+
+      @param buffer - buffer to fill (not NULL)
+      @param count - number of values to read
+    */
+    virtual void readBurst(int* buffer, const int count) {
+      for (int i = 0; i < count; ++i) {
+        buffer[i] = read();
+      }
+    }
+
+    /**
+      Returns the resolution of values of this source
+      for the ADC resolution given to a thermistor.
+      By default, the same; source-wrappers that change
+      the range of values (e.g. oversampling) scale it.
+
+      @param adcResolution - ADC resolution
+      @return resolution of values of this source
+    */
+    virtual int scaleResolution(const int adcResolution) {
+      return adcResolution;
+    }
+};
+
+#endif
@@ -0,0 +1,41 @@
+/**
+  Released into the public domain.
+*/
+#include "AnalogAdcSource.h"
+
+AnalogAdcSource::AnalogAdcSource(const int pin) {
+  pinMode(this->pin = pin, INPUT);
+}
+
+int AnalogAdcSource::read() {
+  return analogRead(this->pin);
+}
+
+#if defined(ESP32)
+MilliVoltAdcSource::MilliVoltAdcSource(
+  const int pin,
+  const uint16_t adcVref,
+  const int adcResolution
+) {
+  pinMode(this->pin = pin, INPUT);
+  this->vref_mv = adcVref;
+  this->adcResolution = adcResolution;
+}
+
+int MilliVoltAdcSource::read() {
+  return (int32_t) analogReadMilliVolts(this->pin) * this->adcResolution / this->vref_mv;
+}
+#endif
+
+#if defined(NTC_BANDGAP_MUX)
+int BandgapAdcSource::read() {
+#if defined(MUX5)
+  ADCSRB &= ~_BV(MUX5);
+#endif
+  ADMUX = _BV(REFS0) | NTC_BANDGAP_MUX;
+  delayMicroseconds(SETTLE_TIME);
+  ADCSRA |= _BV(ADSC);
+  while (bit_is_set(ADCSRA, ADSC));
+  return ADC;
+}
+#endif
@@ -0,0 +1,117 @@
+/**
+  AnalogAdcSource - analog values of an analog port
+  read by analogRead().
+
+  Instantiation:
+  AdcSource* source = new AnalogAdcSource(A1);
+
+  MilliVoltAdcSource (ESP32) - analog values back-calculated
+  from the calibrated analogReadMilliVolts() reading,
+  as in NTC_Thermistor_ESP32.
+
+  Instantiation:
+  AdcSource* source = new MilliVoltAdcSource(3, 3300, 4095);
+
+  BandgapAdcSource (AVR) - analog value of the internal
+  1.1 V bandgap against the AVcc reference, 1.1 / AVcc * 1023
+  (225 at 5 V), the reference channel of RatiometricAdcSource.
+
+  Instantiation:
+  AdcSource* source = new BandgapAdcSource();
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef ANALOG_ADC_SOURCE_H
+#define ANALOG_ADC_SOURCE_H
+
+#include "AdcSource.h"
+
+class AnalogAdcSource final : public AdcSource {
+
+  private:
+    int pin; // an analog port.
+
+  public:
+    /**
+      Constructor
+
+      @param pin - an analog port number
+    */
+    explicit AnalogAdcSource(int pin);
+
+    /**
+      Reads an analog value of the port.
+
+      @return analog value (0...1023, for Arduino)
+    */
+    int read() override;
+};
+
+#if defined(ESP32)
+class MilliVoltAdcSource final : public AdcSource {
+
+  private:
+    // Default analog resolution for ESP32 board
+    static const int DEFAULT_ESP32_ADC_RESOLUTION = 4095;
+
+    int pin; // an analog port.
+    uint16_t vref_mv;
+    int adcResolution;
+
+  public:
+    /**
+      Constructor
+
+      @param pin - an analog port number
+      @param adcVref - The ADC's reference voltage (likely 3300 for 3.3volts)
+      @param adcResolution - ADC resolution (default 4095, for ESP32)
+    */
+    MilliVoltAdcSource(
+      int pin,
+      uint16_t adcVref,
+      int adcResolution = DEFAULT_ESP32_ADC_RESOLUTION
+    );
+
+    /**
+      Reads the calibrated millivolts of the port
+      and back-calculates the analog value.
+
+      @return analog value (0...4095, for ESP32)
+    */
+    int read() override;
+};
+#endif // ESP32
+
+#if defined(__AVR_ATmega328P__) || defined(__AVR_ATmega328__) || defined(__AVR_ATmega168__)
+  // MUX3...0 = 1110: the internal bandgap.
+  #define NTC_BANDGAP_MUX (_BV(MUX3) | _BV(MUX2) | _BV(MUX1))
+#elif defined(__AVR_ATmega32U4__) || defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__)
+  // MUX5...0 = 011110: the internal bandgap.
+  #define NTC_BANDGAP_MUX (_BV(MUX4) | _BV(MUX3) | _BV(MUX2) | _BV(MUX1))
+#endif
+
+#if defined(NTC_BANDGAP_MUX)
+class BandgapAdcSource final : public AdcSource {
+
+  private:
+    // Time for the bandgap to settle after the switch of the multiplexer (us).
+    static const int SETTLE_TIME = 400;
+
+  public:
+    /**
+      Reads the internal bandgap against the AVcc reference.
+      Blocks for the settle time, so it is read
+      once per many readings (see RatiometricAdcSource).
+      analogRead() sets its own reference and channel back.
+
+      @return analog value of the bandgap (225 at 5 V, 1023 at 1.1 V)
+    */
+    int read() override;
+};
+#endif // NTC_BANDGAP_MUX
+#endif
@@ -0,0 +1,32 @@
+/**
+  Released into the public domain.
+*/
+#include "AverageSampleThermistor.h"
+
+AverageSampleThermistor::AverageSampleThermistor(
+  SampleThermistor* origin,
+  const int readingsNumber,
+  const int delayTimeInMillis
+) {
+  this->origin = origin;
+  this->readingsNumber = (readingsNumber > 0) ? readingsNumber : DEFAULT_READINGS_NUMBER;
+  this->delayTime = (delayTimeInMillis > 0) ? delayTimeInMillis : DEFAULT_DELAY_TIME;
+}
+
+AverageSampleThermistor::~AverageSampleThermistor() {
+  delete this->origin;
+}
+
+/*
+  The last sample gives the converter of the mean,
+  no delay after it.
+*/
+LazySample AverageSampleThermistor::readSample() {
+  NTC_Scalar analogSum = 0;
+  for (int i = 1; i < this->readingsNumber; ++i) {
+    analogSum += this->origin->readSample().getAnalog();
+    delay(this->delayTime);
+  }
+  const LazySample last = this->origin->readSample();
+  return last.withAnalog((analogSum + last.getAnalog()) / this->readingsNumber);
+}
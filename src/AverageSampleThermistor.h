@@ -0,0 +1,77 @@
+/**
+  AverageSampleThermistor - class-wrapper allows to average
+  analog values of samples of origin SampleThermistor instance.
+
+  Unlike AverageThermistor, which converts every reading,
+  the analog values are averaged and the mean is converted
+  once, on demand (see LazySample).
+
+  Instantiation:
+  SampleThermistor* thermistor = new AverageSampleThermistor(
+    SAMPLE_THERMISTOR, READINGS_NUMBER, DELAY_TIME
+  );
+
+  Where,
+  SAMPLE_THERMISTOR - origin SampleThermistor instance
+  (NTC_Thermistor, SmoothSampleThermistor...).
+  READINGS_NUMBER - how many samples are averaged (default, 10).
+  DELAY_TIME - delay time between samples (ms, default 1).
+
+  Read a sample:
+  LazySample sample = thermistor->readSample();
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef AVERAGE_SAMPLE_THERMISTOR_H
+#define AVERAGE_SAMPLE_THERMISTOR_H
+
+#include "SampleThermistor.h"
+
+class AverageSampleThermistor final : public SampleThermistor {
+
+  private:
+    // Default number of average samples.
+    static const int DEFAULT_READINGS_NUMBER = 10;
+    // Default delay time of average samples.
+    static const int DEFAULT_DELAY_TIME = 1;
+
+    SampleThermistor* origin;
+    int readingsNumber;
+    int delayTime;
+
+  public:
+    /**
+      Constructor
+
+      @param origin - origin SampleThermistor instance (not NULL)
+      @param readingsNumber - average samples number (default, 10)
+      @param delayTimeInMillis - delay time between samples (ms, default, 1)
+    */
+    AverageSampleThermistor(
+      SampleThermistor* origin,
+      int readingsNumber = DEFAULT_READINGS_NUMBER,
+      int delayTimeInMillis = DEFAULT_DELAY_TIME
+    );
+
+    /**
+      Destructor
+      Deletes the origin SampleThermistor instance.
+    */
+    ~AverageSampleThermistor();
+
+    /**
+      Reads "readingsNumber" samples of the origin
+      with delay "delayTimeInMillis" and averages their
+      analog values, does not convert them.
+
+      @return sample of the mean analog value
+    */
+    LazySample readSample() override;
+};
+
+#endif
@@ -12,26 +12,96 @@ AverageThermistor::AverageThermistor(
   this->origin = origin;
   this->readingsNumber = validate(readingsNumber, DEFAULT_READINGS_NUMBER);
   this->delayTime = validate(delayTimeInMillis, DEFAULT_DELAY_TIME);
+  // the first update() takes a reading right away.
+  this->lastReadingTime = millis() - this->delayTime;
 }
 
 AverageThermistor::~AverageThermistor() {
   delete this->origin;
 }
 
-double AverageThermistor::readCelsius() {
+NTC_Scalar AverageThermistor::readCelsius() {
   return average(&Thermistor::readCelsius);
 }
 
-double AverageThermistor::readKelvin() {
+NTC_Scalar AverageThermistor::readKelvin() {
   return average(&Thermistor::readKelvin);
 }
 
-double AverageThermistor::readFahrenheit() {
+NTC_Scalar AverageThermistor::readFahrenheit() {
   return average(&Thermistor::readFahrenheit);
 }
 
-inline double AverageThermistor::average(double (Thermistor::*read)()) {
-  double sum = 0;
+/*
+  The mean is rounded half away from zero,
+  as the floating-point temperatures are.
+*/
+int32_t AverageThermistor::readCentiCelsius() {
+  int32_t sum = 0;
+  for (int i = 0; i < this->readingsNumber; ++i) {
+    const int32_t centiCelsius = this->origin->readCentiCelsius();
+    if (centiCelsius == NTC_NO_CENTI_CELSIUS) {
+      return NTC_NO_CENTI_CELSIUS;
+    }
+    sum += centiCelsius;
+    sleep();
+  }
+  const int32_t half = this->readingsNumber / 2;
+  return (sum + ((sum < 0) ? -half : half)) / this->readingsNumber;
+}
+
+ThermistorReading AverageThermistor::read() {
+  NTC_Scalar analogSum = 0;
+  NTC_Scalar resistanceSum = 0;
+  NTC_Scalar kelvinSum = 0;
+  for (int i = 0; i < this->readingsNumber; ++i) {
+    const ThermistorReading reading = this->origin->read();
+    analogSum += reading.analog;
+    resistanceSum += reading.resistance;
+    kelvinSum += reading.kelvin;
+    sleep();
+  }
+  return ThermistorReading(
+    kelvinSum / this->readingsNumber,
+    resistanceSum / this->readingsNumber,
+    analogSum / this->readingsNumber
+  );
+}
+
+bool AverageThermistor::update() {
+  const unsigned long now = millis();
+  if (now - this->lastReadingTime < (unsigned long) this->delayTime) {
+    return false;
+  }
+  this->lastReadingTime = now;
+  this->kelvinSum += this->origin->readKelvin();
+  if (++this->readingsCount < this->readingsNumber) {
+    return false;
+  }
+  this->averageKelvin = this->kelvinSum / this->readingsNumber;
+  this->kelvinSum = 0;
+  this->readingsCount = 0;
+  return this->ready = true;
+}
+
+bool AverageThermistor::isReady() {
+  return this->ready;
+}
+
+NTC_Scalar AverageThermistor::getCelsius() {
+  return (this->averageKelvin - NTC_Scalar(273.15));
+}
+
+NTC_Scalar AverageThermistor::getKelvin() {
+  return this->averageKelvin;
+}
+
+NTC_Scalar AverageThermistor::getFahrenheit() {
+  return (getCelsius() * NTC_Scalar(1.8) + 32);
+}
+
+inline NTC_Scalar AverageThermistor::average(NTC_Scalar (Thermistor::*read)()) {
+  NTC_Scalar sum = 0;
   for (int i = 0; i < this->readingsNumber; ++i) {
     sum += (this->origin->*read)();
     sleep();
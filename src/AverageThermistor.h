@@ -23,6 +23,15 @@
   double kelvin = thermistor->readKelvin();
   double fahrenheit = thermistor->readFahrenheit();
 
+  Non-blocking reading (from loop(), without delay()):
+  AverageThermistor* thermistor = new AverageThermistor(...);
+  thermistor->update(); // takes one reading when DELAY_TIME passed
+  if (thermistor->isReady()) {
+    double celsius = thermistor->getCelsius();
+    double kelvin = thermistor->getKelvin();
+    double fahrenheit = thermistor->getFahrenheit();
+  }
+
   v.2.0.0
   - created
 
@@ -35,6 +44,12 @@
   v.2.0.3
   - replaced "define" constants with "static const"
 
+  v.2.2.0
+  - added readCentiCelsius() method, averages integers;
+  - added non-blocking update(), isReady() and get*() methods;
+  - added read() method, averages all units at once;
+  - averages in NTC_Scalar (see NTC_SINGLE_PRECISION).
+
   https://github.com/YuriiSalimov/NTC_Thermistor
 
   Created by Yurii Salimov, May, 2019.
@@ -57,6 +72,13 @@ class AverageThermistor final : public Thermistor {
     int readingsNumber;
     int delayTime;
 
+    // Non-blocking averaging state.
+    unsigned long lastReadingTime;
+    int readingsCount = 0;
+    NTC_Scalar kelvinSum = 0;
+    NTC_Scalar averageKelvin = 0;
+    bool ready = false;
+
   public:
     /**
       Constructor
@@ -82,21 +104,73 @@ class AverageThermistor final : public Thermistor {
 
       @return average temperature in degree Celsius
     */
-    double readCelsius() override;
+    NTC_Scalar readCelsius() override;
 
     /**
       Reads a temperature in Kelvin from the thermistor.
 
       @return average temperature in degree Kelvin
     */
-    double readKelvin() override;
+    NTC_Scalar readKelvin() override;
 
     /**
       Reads a temperature in Fahrenheit from the thermistor.
 
       @return average temperature in degree Fahrenheit
     */
-    double readFahrenheit() override;
+    NTC_Scalar readFahrenheit() override;
+
+    /**
+      Reads a temperature in hundredths of degree Celsius
+      from the thermistor.
+
+      @return average temperature in hundredths of degree Celsius,
+      rounded (NTC_NO_CENTI_CELSIUS if a reading is unknown)
+    */
+    int32_t readCentiCelsius() override;
+
+    /**
+      Reads the origin thermistor "readingsNumber" times
+      with delay "delayTimeInMillis", averages the analog value,
+      the resistance and the temperature at once.
+
+      @return average thermistor reading
+    */
+    ThermistorReading read() override;
+
+    /**
+      Takes one reading in Kelvin from the origin Thermistor
+      if the delay time has passed since the previous one.
+      When "readingsNumber" readings are taken, publishes
+      their average and starts a new one. Never blocks,
+      must be called regularly, for example, from loop().
+
+      @return true if a new average is published
+    */
+    bool update();
+
+    /**
+      @return true if at least one average is published by update()
+    */
+    bool isReady();
+
+    /**
+      @return the latest average temperature
+      published by update() in degree Celsius
+    */
+    NTC_Scalar getCelsius();
+
+    /**
+      @return the latest average temperature
+      published by update() in degree Kelvin
+    */
+    NTC_Scalar getKelvin();
+
+    /**
+      @return the latest average temperature
+      published by update() in degree Fahrenheit
+    */
+    NTC_Scalar getFahrenheit();
 
   private:
     /**
@@ -107,7 +181,7 @@ class AverageThermistor final : public Thermistor {
       @param *read - origin method that return temperature (not NULL)
       @return average temperature from the input *read() method
     */
-    inline double average(double (Thermistor::*read)());
+    inline NTC_Scalar average(NTC_Scalar (Thermistor::*read)());
 
     /**
       For delay between readings.
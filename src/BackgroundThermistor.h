@@ -0,0 +1,188 @@
+/**
+  BackgroundThermistor - NTC thermistor sampled in the background.
+
+  Splits a reading into three contexts:
+  sample() - reads one analog value and pushes it into a lock-free
+  ring buffer (SampleRing), called by a hardware timer interrupt
+  or an RTOS task, no floating point, no waiting;
+  process() - pops the values, averages them and converts
+  the mean once, then publishes the reading by a sequence lock,
+  called by loop() or an RTOS task;
+  readCelsius(), readKelvin(), readFahrenheit(), read() - return
+  the published reading in constant time, never touch the ADC;
+  before the first reading (see isReady()) temperatures are NAN
+  and readCentiCelsius() is NTC_NO_CENTI_CELSIUS (INT32_MIN).
+
+  The sequence lock: the writer makes the sequence odd, writes
+  the reading and makes it even again; a reader copies the reading
+  and retries if the sequence was odd or changed meanwhile.
+  So the reading is never torn and nobody waits for the writer,
+  except a reader that runs in the middle of a write.
+  process() must not be called by several contexts at once
+  and a reader must not interrupt process() on the same core.
+
+  Instantiation:
+  BackgroundThermistor<RING_SIZE>* thermistor = new BackgroundThermistor<RING_SIZE>(
+    SENSOR_PIN, 8000, 100000, 25, 3950
+  );
+  Constructors are the same as of NTC_Thermistor (AdcSource, models...).
+
+  Where,
+  RING_SIZE - slots of the ring buffer, a power of two (default, 32),
+  enough for the values sampled between two process() calls.
+
+  Timer interrupt (or RTOS task):
+  thermistor->sample();
+
+  loop():
+  thermistor->process();
+  double celsius = thermistor->readCelsius();
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef BACKGROUND_THERMISTOR_H
+#define BACKGROUND_THERMISTOR_H
+
+#include "NTC_Thermistor.h"
+#include "SampleRing.h"
+
+template <int RING_SIZE = 32>
+class BackgroundThermistor final : public NTC_Thermistor {
+
+  private:
+    SampleRing<RING_SIZE> ring;
+    // Odd while the reading is written, one byte to be atomic on 8-bit MCUs.
+    volatile uint8_t sequence = 0;
+    volatile bool ready = false;
+    volatile NTC_Scalar analog = NAN;
+    volatile NTC_Scalar resistance = NAN;
+    volatile NTC_Scalar kelvin = NAN;
+
+  public:
+    using NTC_Thermistor::NTC_Thermistor;
+
+    /**
+      Reads one analog value into the ring buffer.
+      Safe to call from an interrupt.
+
+      @return true if the value is stored, false if the ring is full
+    */
+    inline bool sample() {
+      return this->ring.push((uint16_t) readAnalog());
+    }
+
+    /**
+      Converts the mean of the sampled values
+      and publishes the reading.
+
+      @return true if a new reading is published,
+      false if there are no new values
+    */
+    bool process() {
+      uint32_t sum = 0;
+      uint16_t count = 0;
+      uint16_t value;
+      while (this->ring.pop(value)) {
+        sum += value;
+        ++count;
+      }
+      if (count == 0) {
+        return false;
+      }
+      const NTC_Scalar meanAnalog = (NTC_Scalar) sum / count;
+      const NTC_Scalar meanResistance = analogToResistance(meanAnalog);
+      const NTC_Scalar meanKelvin = resistanceToKelvins(meanResistance);
+
+      this->sequence = this->sequence + 1;
+      NTC_MEMORY_BARRIER();
+      this->analog = meanAnalog;
+      this->resistance = meanResistance;
+      this->kelvin = meanKelvin;
+      NTC_MEMORY_BARRIER();
+      this->sequence = this->sequence + 1;
+      this->ready = true;
+      return true;
+    }
+
+    /**
+      @return true if a reading is published
+    */
+    inline bool isReady() {
+      return this->ready;
+    }
+
+    /**
+      @return how many sampled values are dropped
+      because the ring buffer was full
+    */
+    inline uint16_t getOverruns() const {
+      return this->ring.getOverruns();
+    }
+
+    /**
+      @return sample of the published analog value,
+      converted on demand (NAN before the first reading)
+    */
+    LazySample readSample() override {
+      return LazySample(this, read().analog);
+    }
+
+    /**
+      @return published temperature in degree Celsius
+      (NAN before the first reading)
+    */
+    NTC_Scalar readCelsius() override {
+      return read().celsius;
+    }
+
+    /**
+      @return published temperature in degree Kelvin
+      (NAN before the first reading)
+    */
+    NTC_Scalar readKelvin() override {
+      return read().kelvin;
+    }
+
+    /**
+      @return published temperature in degree Fahrenheit
+      (NAN before the first reading)
+    */
+    NTC_Scalar readFahrenheit() override {
+      return read().fahrenheit;
+    }
+
+    /**
+      @return published temperature in hundredths of degree Celsius
+      (NTC_NO_CENTI_CELSIUS before the first reading,
+      never a real temperature)
+    */
+    int32_t readCentiCelsius() override {
+      return isReady() ? Thermistor::readCentiCelsius() : NTC_NO_CENTI_CELSIUS;
+    }
+
+    /**
+      @return published reading in all units
+    */
+    ThermistorReading read() override {
+      uint8_t before;
+      NTC_Scalar copiedAnalog;
+      NTC_Scalar copiedResistance;
+      NTC_Scalar copiedKelvin;
+      do {
+        before = this->sequence;
+        NTC_MEMORY_BARRIER();
+        copiedAnalog = this->analog;
+        copiedResistance = this->resistance;
+        copiedKelvin = this->kelvin;
+        NTC_MEMORY_BARRIER();
+      } while ((before & 1) || (before != this->sequence));
+      return ThermistorReading(copiedKelvin, copiedResistance, copiedAnalog);
+    }
+};
+
+#endif
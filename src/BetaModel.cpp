@@ -0,0 +1,29 @@
+/**
+  Released into the public domain.
+*/
+#include "BetaModel.h"
+
+BetaModel::BetaModel(
+  const double nominalResistance,
+  const double nominalTemperatureCelsius,
+  const double bValue
+) {
+  this->inverseBValue = 1.0 / bValue;
+  this->offset = 1.0 / (nominalTemperatureCelsius + 273.15) -
+    log(nominalResistance) * this->inverseBValue;
+}
+
+NTC_Scalar BetaModel::resistanceToKelvins(const NTC_Scalar resistance) {
+  return 1 / (this->offset + NTC_LOG(resistance) * this->inverseBValue);
+}
+
+BetaModel BetaModel::fit(
+  const double resistance1,
+  const double celsius1,
+  const double resistance2,
+  const double celsius2
+) {
+  const double bValue = log(resistance1 / resistance2) /
+    (1.0 / (celsius1 + 273.15) - 1.0 / (celsius2 + 273.15));
+  return BetaModel(resistance1, celsius1, bValue);
+}
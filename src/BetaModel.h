@@ -0,0 +1,71 @@
+/**
+  BetaModel - B-value equation of a thermistor:
+  1/K = 1/K0 + ln(R/R0)/B;
+  Evaluated as 1/K = (1/K0 - ln(R0)/B) + ln(R) * (1/B),
+  the first part and 1/B are precomputed.
+
+  Instantiation, for example, to NTC 3950 thermistor:
+  ThermistorModel* model = new BetaModel(100000, 25, 3950);
+
+  Or fitted to two calibration points:
+  BetaModel model = BetaModel::fit(R1, C1, R2, C2);
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef BETA_MODEL_H
+#define BETA_MODEL_H
+
+#include "ThermistorModel.h"
+
+class BetaModel final : public ThermistorModel {
+
+  private:
+    NTC_Scalar offset; // 1/K0 - ln(R0)/B
+    NTC_Scalar inverseBValue; // 1/B
+
+  public:
+    /**
+      Constructor
+
+      @param nominalResistance - nominal resistance at a nominal temperature
+      @param nominalTemperatureCelsius - nominal temperature in Celsius
+      @param bValue - b-value of a thermistor
+    */
+    BetaModel(
+      double nominalResistance,
+      double nominalTemperatureCelsius,
+      double bValue
+    );
+
+    /**
+      Converts a resistance of the thermistor into a temperature.
+
+      @param resistance - resistance value to convert (> 0)
+      @return temperature in degree Kelvin
+    */
+    NTC_Scalar resistanceToKelvins(NTC_Scalar resistance) override;
+
+    /**
+      Fits the model to two calibration points:
+      B = ln(R1/R2) / (1/K1 - 1/K2);
+
+      @param resistance1 - resistance at the first point
+      @param celsius1 - temperature of the first point in Celsius
+      @param resistance2 - resistance at the second point
+      @param celsius2 - temperature of the second point in Celsius
+      @return fitted model
+    */
+    static BetaModel fit(
+      double resistance1,
+      double celsius1,
+      double resistance2,
+      double celsius2
+    );
+};
+
+#endif
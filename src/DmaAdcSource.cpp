@@ -0,0 +1,54 @@
+/**
+  Released into the public domain.
+*/
+#include "DmaAdcSource.h"
+
+DmaAdcSource::DmaAdcSource(
+  const volatile uint16_t* buffer,
+  const int length,
+  const int channels,
+  const int channel
+) {
+  this->buffer = buffer;
+  this->length = max(length, 0);
+  this->channels = max(channels, 1);
+  this->channel = constrain(channel, 0, this->channels - 1);
+  this->next = this->channel;
+}
+
+/*
+  The buffer is overwritten while it is read,
+  so each sample is read once, as a whole 16-bit value
+  (a torn average of old and new samples is still valid).
+*/
+int DmaAdcSource::read() {
+  uint32_t sum = 0;
+  int count = 0;
+  for (int i = this->channel; i < this->length; i += this->channels) {
+    sum += this->buffer[i];
+    ++count;
+  }
+  return (count > 0) ? (int) ((sum + count / 2) / count) : 0;
+}
+
+/*
+  Raw samples, one by one in the order of the buffer,
+  so an oversampling of this source sums distinct samples
+  instead of copies of one average. The next burst goes on
+  from the next sample, starting over after the last one.
+*/
+void DmaAdcSource::readBurst(int* buffer, const int count) {
+  if (this->channel >= this->length) {
+    for (int i = 0; i < count; ++i) {
+      buffer[i] = 0;
+    }
+    return;
+  }
+  for (int i = 0; i < count; ++i) {
+    if (this->next >= this->length) {
+      this->next = this->channel;
+    }
+    buffer[i] = this->buffer[this->next];
+    this->next += this->channels;
+  }
+}
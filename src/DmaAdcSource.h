@@ -0,0 +1,79 @@
+/**
+  DmaAdcSource - analog values from a buffer that is
+  filled continuously in the background: by DMA in circular
+  mode (STM32) or by a continuous conversion callback (ESP32).
+  A reading never starts a conversion, it averages
+  the samples of the channel that are already in the buffer.
+  A burst (see OversamplingAdcSource) takes the samples
+  one by one instead, without averaging.
+
+  The buffer holds interleaved samples of "CHANNELS"
+  analog ports scanned in order:
+  [ch0, ch1, ..., ch0, ch1, ...].
+
+  Instantiation, for example, STM32 HAL:
+  volatile uint16_t buffer[LENGTH];
+  HAL_ADC_Start_DMA(&hadc1, (uint32_t*) buffer, LENGTH);
+
+  AdcSource* source = new DmaAdcSource(buffer, LENGTH, CHANNELS, CHANNEL);
+  Thermistor* thermistor = new NTC_Thermistor(
+    source, 8000, 100000, 25, 3950, 4095
+  );
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef DMA_ADC_SOURCE_H
+#define DMA_ADC_SOURCE_H
+
+#include "AdcSource.h"
+
+class DmaAdcSource final : public AdcSource {
+
+  private:
+    const volatile uint16_t* buffer;
+    int length;
+    int channels;
+    int channel;
+    // Buffer index of the next sample of a burst.
+    int next;
+
+  public:
+    /**
+      Constructor
+
+      @param buffer - buffer filled in the background (not NULL)
+      @param length - number of samples in the buffer
+      @param channels - number of interleaved channels (default, 1)
+      @param channel - channel of the thermistor (default, 0)
+    */
+    DmaAdcSource(
+      const volatile uint16_t* buffer,
+      int length,
+      int channels = 1,
+      int channel = 0
+    );
+
+    /**
+      Reads an analog value of the channel:
+      the average of its samples in the buffer.
+
+      @return analog value (0...ADC resolution)
+    */
+    int read() override;
+
+    /**
+      Reads samples of the channel one by one, in the order
+      of the buffer, starting over after the last one.
+
+      @param buffer - buffer to fill (not NULL)
+      @param count - number of values to read
+    */
+    void readBurst(int* buffer, int count) override;
+};
+
+#endif
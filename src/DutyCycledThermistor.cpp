@@ -0,0 +1,138 @@
+/**
+  Released into the public domain.
+*/
+#include "DutyCycledThermistor.h"
+
+DutyCycledThermistor::DutyCycledThermistor(
+  Thermistor* origin,
+  const int excitationPin,
+  const unsigned long settleTimeInMicros,
+  const unsigned long periodInMillis
+) {
+  this->origin = origin;
+  this->excitationPin = excitationPin;
+  this->settleTime = settleTimeInMicros;
+  this->period = periodInMillis;
+  pinMode(excitationPin, OUTPUT);
+  digitalWrite(excitationPin, LOW);
+}
+
+DutyCycledThermistor::~DutyCycledThermistor() {
+  delete this->origin;
+}
+
+NTC_Scalar DutyCycledThermistor::readCelsius() {
+  const unsigned long onTime = powerOn();
+  const NTC_Scalar celsius = this->origin->readCelsius();
+  powerOff(onTime);
+  return celsius;
+}
+
+NTC_Scalar DutyCycledThermistor::readKelvin() {
+  const unsigned long onTime = powerOn();
+  const NTC_Scalar kelvin = this->origin->readKelvin();
+  powerOff(onTime);
+  return kelvin;
+}
+
+NTC_Scalar DutyCycledThermistor::readFahrenheit() {
+  const unsigned long onTime = powerOn();
+  const NTC_Scalar fahrenheit = this->origin->readFahrenheit();
+  powerOff(onTime);
+  return fahrenheit;
+}
+
+int32_t DutyCycledThermistor::readCentiCelsius() {
+  const unsigned long onTime = powerOn();
+  const int32_t centiCelsius = this->origin->readCentiCelsius();
+  powerOff(onTime);
+  return centiCelsius;
+}
+
+ThermistorReading DutyCycledThermistor::read() {
+  const unsigned long onTime = powerOn();
+  const ThermistorReading reading = this->origin->read();
+  powerOff(onTime);
+  return reading;
+}
+
+/*
+  The settle time is counted by micros() and the period by millis(),
+  both with unsigned subtraction, so they survive the overflow.
+  The first call powers the divider on right away.
+  A blocking reading in between leaves the divider powered.
+*/
+bool DutyCycledThermistor::update() {
+  if (!this->powered) {
+    if (this->ready && (millis() - this->lastReadingTime < this->period)) {
+      return false;
+    }
+    digitalWrite(this->excitationPin, HIGH);
+    this->powered = true;
+    this->powerOnTime = micros();
+    return false;
+  }
+  if (micros() - this->powerOnTime < this->settleTime) {
+    return false;
+  }
+  this->reading = this->origin->read();
+  digitalWrite(this->excitationPin, LOW);
+  this->powered = false;
+  this->poweredTime = micros() - this->powerOnTime;
+  this->lastReadingTime = millis();
+  return this->ready = true;
+}
+
+bool DutyCycledThermistor::isReady() {
+  return this->ready;
+}
+
+ThermistorReading DutyCycledThermistor::getReading() {
+  return this->reading;
+}
+
+NTC_Scalar DutyCycledThermistor::getCelsius() {
+  return this->reading.celsius;
+}
+
+NTC_Scalar DutyCycledThermistor::getKelvin() {
+  return this->reading.kelvin;
+}
+
+NTC_Scalar DutyCycledThermistor::getFahrenheit() {
+  return this->reading.fahrenheit;
+}
+
+unsigned long DutyCycledThermistor::getPoweredTime() {
+  return this->poweredTime;
+}
+
+/*
+  While update() is settling, the divider is already powered:
+  a blocking reading waits the rest of that settle time only
+  and leaves the divider on for the update().
+*/
+inline unsigned long DutyCycledThermistor::powerOn() {
+  if (this->powered) {
+    const unsigned long elapsed = micros() - this->powerOnTime;
+    wait(this->settleTime - min(elapsed, this->settleTime));
+    return this->powerOnTime;
+  }
+  digitalWrite(this->excitationPin, HIGH);
+  const unsigned long onTime = micros();
+  wait(this->settleTime);
+  return onTime;
+}
+
+inline void DutyCycledThermistor::powerOff(const unsigned long onTime) {
+  this->poweredTime = micros() - onTime;
+  if (!this->powered) {
+    digitalWrite(this->excitationPin, LOW);
+  }
+}
+
+inline void DutyCycledThermistor::wait(const unsigned long time) {
+  // delayMicroseconds() is exact up to 16383 us only.
+  delay(time / 1000);
+  delayMicroseconds(time % 1000);
+}
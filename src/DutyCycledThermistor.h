@@ -0,0 +1,203 @@
+/**
+  DutyCycledThermistor - class-wrapper allows to power
+  the divider of origin Thermistor instance by a GPIO
+  (excitation pin) only around a reading.
+
+  The divider is supplied by the excitation pin
+  instead of the reference voltage:
+  EXCITATION_PIN -> R0 -> analog pin -> NTC -> GND.
+  Between readings the pin is low, so the divider draws
+  no current and the NTC does not heat itself.
+
+  Instantiation:
+  DutyCycledThermistor* thermistor = new DutyCycledThermistor(
+    THERMISTOR, EXCITATION_PIN, SETTLE_TIME, PERIOD
+  );
+
+  Where,
+  THERMISTOR - origin Thermistor instance.
+  EXCITATION_PIN - digital port that powers the divider.
+  SETTLE_TIME - time from power on to a reading (us, default 1000):
+  about 5 time constants of the divider and its filter capacitor
+  (e.g. 8 kOhm || 100 kOhm and 100 nF: 5 * 0.74 ms = 3.7 ms).
+  PERIOD - time between readings of update() (ms, default 0).
+
+  Read temperature (blocking, waits SETTLE_TIME):
+  double celsius = thermistor->readCelsius();
+  double kelvin = thermistor->readKelvin();
+  double fahrenheit = thermistor->readFahrenheit();
+
+  Non-blocking reading (from loop(), the settle time is not waited):
+  thermistor->update(); // powers on, then reads after SETTLE_TIME
+  if (thermistor->isReady()) {
+    double celsius = thermistor->getCelsius();
+  }
+
+  Energy of a reading: E = V^2 / (R0 + Rntc) * T, where T is
+  the powered time of the latest reading, see getPoweredTime().
+  For example, 5 V, 8 kOhm + 100 kOhm (25 C), T = 1 ms:
+  0.23 uJ, once a minute - 4 nW on average instead of 0.23 mW
+  of the divider powered continuously, and the self-heating
+  (0.21 mW in the NTC, ~0.15 C at 1.5 mW/C) is gone.
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef DUTY_CYCLED_THERMISTOR_H
+#define DUTY_CYCLED_THERMISTOR_H
+
+#include "Thermistor.h"
+
+class DutyCycledThermistor final : public Thermistor {
+
+  private:
+    // Default settle time (us).
+    static const unsigned long DEFAULT_SETTLE_TIME = 1000;
+
+    Thermistor* origin;
+    int excitationPin;
+    unsigned long settleTime;
+    unsigned long period;
+
+    // Non-blocking reading state,
+    // true while update() waits the settle time.
+    bool powered = false;
+    unsigned long powerOnTime = 0;
+    unsigned long lastReadingTime = 0;
+    unsigned long poweredTime = 0;
+    ThermistorReading reading;
+    bool ready = false;
+
+  public:
+    /**
+      Constructor
+      Powers the divider down.
+
+      @param origin - origin Thermistor instance (not NULL)
+      @param excitationPin - digital port that powers the divider
+      @param settleTimeInMicros - time from power on to a reading (us, default 1000)
+      @param periodInMillis - time between readings of update() (ms, default 0)
+    */
+    DutyCycledThermistor(
+      Thermistor* origin,
+      int excitationPin,
+      unsigned long settleTimeInMicros = DEFAULT_SETTLE_TIME,
+      unsigned long periodInMillis = 0
+    );
+
+    /**
+      Destructor
+      Deletes the origin Thermistor instance.
+    */
+    ~DutyCycledThermistor();
+
+    /**
+      Powers the divider, waits the settle time,
+      reads a temperature in Celsius and powers the divider down.
+
+      @return temperature in degree Celsius
+    */
+    NTC_Scalar readCelsius() override;
+
+    /**
+      Powers the divider, waits the settle time,
+      reads a temperature in Kelvin and powers the divider down.
+
+      @return temperature in degree Kelvin
+    */
+    NTC_Scalar readKelvin() override;
+
+    /**
+      Powers the divider, waits the settle time,
+      reads a temperature in Fahrenheit and powers the divider down.
+
+      @return temperature in degree Fahrenheit
+    */
+    NTC_Scalar readFahrenheit() override;
+
+    /**
+      Powers the divider, waits the settle time, reads a temperature
+      in hundredths of degree Celsius and powers the divider down.
+
+      @return temperature in hundredths of degree Celsius
+    */
+    int32_t readCentiCelsius() override;
+
+    /**
+      Powers the divider, waits the settle time,
+      reads the origin once and powers the divider down.
+
+      @return thermistor reading
+    */
+    ThermistorReading read() override;
+
+    /**
+      Non-blocking reading: when the period has passed since
+      the previous reading, powers the divider on and returns;
+      once the settle time has passed, reads the origin,
+      powers the divider down and publishes the reading.
+      Must be called regularly, for example, from loop().
+
+      @return true if a new reading is published
+    */
+    bool update();
+
+    /**
+      @return true if at least one reading is published by update()
+    */
+    bool isReady();
+
+    /**
+      @return the latest reading published by update()
+    */
+    ThermistorReading getReading();
+
+    /**
+      @return the latest temperature published by update() in degree Celsius
+    */
+    NTC_Scalar getCelsius();
+
+    /**
+      @return the latest temperature published by update() in degree Kelvin
+    */
+    NTC_Scalar getKelvin();
+
+    /**
+      @return the latest temperature published by update() in degree Fahrenheit
+    */
+    NTC_Scalar getFahrenheit();
+
+    /**
+      @return how long the divider was powered
+      for the latest reading (us), to estimate its energy
+    */
+    unsigned long getPoweredTime();
+
+  private:
+    /**
+      Powers the divider and waits the settle time,
+      the rest of it if update() has powered the divider.
+
+      @return time of power on (us)
+    */
+    inline unsigned long powerOn();
+
+    /**
+      Keeps the powered time and powers the divider down,
+      unless update() is waiting for it.
+
+      @param onTime - time of power on (us)
+    */
+    inline void powerOff(unsigned long onTime);
+
+    /**
+      Waits a time in microseconds.
+    */
+    static inline void wait(unsigned long time);
+};
+
+#endif
@@ -0,0 +1,20 @@
+/**
+  Released into the public domain.
+*/
+#include "FakeAdcSource.h"
+
+FakeAdcSource::FakeAdcSource(const int* values, const int length) {
+  this->values = values;
+  this->length = max(length, 1);
+}
+
+int FakeAdcSource::read() {
+  const int value = this->values[this->position];
+  this->position = (this->position + 1) % this->length;
+  ++this->readingsCount;
+  return value;
+}
+
+unsigned long FakeAdcSource::getReadingsCount() {
+  return this->readingsCount;
+}
@@ -0,0 +1,54 @@
+/**
+  FakeAdcSource - scripted analog values,
+  for testing thermistors without hardware (e.g. on a host).
+  Returns the values one by one and starts over
+  after the last one.
+
+  Instantiation:
+  const int VALUES[] = { 500, 510, 490 };
+  FakeAdcSource source(VALUES, 3);
+  Thermistor* thermistor = new NTC_Thermistor(
+    &source, 8000, 100000, 25, 3950
+  );
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef FAKE_ADC_SOURCE_H
+#define FAKE_ADC_SOURCE_H
+
+#include "AdcSource.h"
+
+class FakeAdcSource final : public AdcSource {
+
+  private:
+    const int* values;
+    int length;
+    int position = 0;
+    unsigned long readingsCount = 0;
+
+  public:
+    /**
+      Constructor
+
+      @param values - values to return (not NULL, not copied)
+      @param length - number of values (> 0)
+    */
+    FakeAdcSource(const int* values, int length);
+
+    /**
+      @return the next scripted value
+    */
+    int read() override;
+
+    /**
+      @return how many values are read
+    */
+    unsigned long getReadingsCount();
+};
+
+#endif
@@ -0,0 +1,191 @@
+/**
+  MedianThermistor - class-wrapper allows to reject outliers
+  (spikes) in the temperature value of origin Thermistor instance.
+
+  Takes a small burst of readings, sorts them by a fixed
+  sorting network (no loops over data, no general sort)
+  and returns the median, or the mean of the middle readings
+  when TRIM is less than the half of the burst (trimmed mean).
+
+  Instantiation:
+  Thermistor* thermistor = new MedianThermistor<BURST_SIZE, TRIM>(
+    THERMISTOR, DELAY_TIME
+  );
+
+  Where,
+  THERMISTOR - origin Thermistor instance.
+  BURST_SIZE - readings per burst: 3, 5, 7 or 9.
+  TRIM - how many lowest and highest readings are dropped
+  (default, (BURST_SIZE - 1) / 2 - median).
+  DELAY_TIME - delay time between readings of a burst
+  (ms, default, 0 - no delay).
+
+  Read temperature:
+  double celsius = thermistor->readCelsius();
+  double kelvin = thermistor->readKelvin();
+  double fahrenheit = thermistor->readFahrenheit();
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef MEDIAN_THERMISTOR_H
+#define MEDIAN_THERMISTOR_H
+
+#include "Thermistor.h"
+
+/**
+  Sorting networks: pairs of positions to compare and swap.
+  Sort all values, so the trimmed mean works with any TRIM.
+*/
+template <int SIZE>
+struct MedianNetwork;
+
+template <>
+struct MedianNetwork<3> {
+  static const int LENGTH = 3;
+  static const uint8_t* pairs() {
+    static const uint8_t PAIRS[] = { 0,2, 0,1, 1,2 };
+    return PAIRS;
+  }
+};
+
+template <>
+struct MedianNetwork<5> {
+  static const int LENGTH = 9;
+  static const uint8_t* pairs() {
+    static const uint8_t PAIRS[] = {
+      0,1, 3,4, 2,4, 2,3, 0,3, 0,2, 1,4, 1,3, 1,2
+    };
+    return PAIRS;
+  }
+};
+
+template <>
+struct MedianNetwork<7> {
+  static const int LENGTH = 16;
+  static const uint8_t* pairs() {
+    static const uint8_t PAIRS[] = {
+      0,6, 2,3, 4,5, 0,2, 1,4, 3,6, 0,1, 2,5,
+      3,4, 1,2, 4,6, 2,3, 4,5, 1,2, 3,4, 5,6
+    };
+    return PAIRS;
+  }
+};
+
+template <>
+struct MedianNetwork<9> {
+  static const int LENGTH = 25;
+  static const uint8_t* pairs() {
+    static const uint8_t PAIRS[] = {
+      0,1, 3,4, 6,7, 1,2, 4,5, 7,8, 0,1, 3,4, 6,7,
+      0,3, 3,6, 0,3, 1,4, 4,7, 1,4, 2,5, 5,8, 2,5,
+      1,3, 5,7, 2,6, 4,6, 2,4, 2,3, 5,6
+    };
+    return PAIRS;
+  }
+};
+
+template <int BURST_SIZE, int TRIM = (BURST_SIZE - 1) / 2>
+class MedianThermistor final : public Thermistor {
+
+  private:
+    static_assert((BURST_SIZE == 3) || (BURST_SIZE == 5) ||
+      (BURST_SIZE == 7) || (BURST_SIZE == 9), "BURST_SIZE must be 3, 5, 7 or 9");
+    static_assert((TRIM >= 0) && (2 * TRIM < BURST_SIZE), "TRIM must keep at least one reading");
+
+    Thermistor* origin;
+    int delayTime;
+
+  public:
+    /**
+      Constructor
+
+      @param origin - origin Thermistor instance (not NULL)
+      @param delayTimeInMillis - delay time between readings
+      of a burst in milliseconds (default, 0 - no delay)
+    */
+    explicit MedianThermistor(Thermistor* origin, const int delayTimeInMillis = 0) {
+      this->origin = origin;
+      this->delayTime = max(delayTimeInMillis, 0);
+    }
+
+    /**
+      Destructor
+      Deletes the origin Thermistor instance.
+    */
+    ~MedianThermistor() {
+      delete this->origin;
+    }
+
+    /**
+      Reads a temperature in Celsius from the thermistor.
+
+      @return filtered temperature in degree Celsius
+    */
+    NTC_Scalar readCelsius() override {
+      return (readKelvin() - NTC_Scalar(273.15));
+    }
+
+    /**
+      Reads a temperature in Kelvin from the thermistor.
+
+      @return filtered temperature in degree Kelvin
+    */
+    NTC_Scalar readKelvin() override {
+      NTC_Scalar kelvins[BURST_SIZE];
+      for (int i = 0; i < BURST_SIZE; ++i) {
+        kelvins[i] = this->origin->readKelvin();
+        sleep();
+      }
+      return filter(kelvins);
+    }
+
+    /**
+      Reads a temperature in Fahrenheit from the thermistor.
+
+      @return filtered temperature in degree Fahrenheit
+    */
+    NTC_Scalar readFahrenheit() override {
+      return (readCelsius() * NTC_Scalar(1.8) + 32);
+    }
+
+  private:
+    /**
+      Sorts the burst and averages its middle readings.
+
+      @param kelvins - burst of temperatures in degree Kelvin
+      @return filtered temperature in degree Kelvin
+    */
+    inline NTC_Scalar filter(NTC_Scalar* kelvins) {
+      const uint8_t* pairs = MedianNetwork<BURST_SIZE>::pairs();
+      for (int i = 0; i < MedianNetwork<BURST_SIZE>::LENGTH; ++i) {
+        NTC_Scalar& low = kelvins[pairs[2 * i]];
+        NTC_Scalar& high = kelvins[pairs[2 * i + 1]];
+        if (low > high) {
+          const NTC_Scalar swap = low;
+          low = high;
+          high = swap;
+        }
+      }
+      NTC_Scalar sum = 0;
+      for (int i = TRIM; i < BURST_SIZE - TRIM; ++i) {
+        sum += kelvins[i];
+      }
+      return (sum / (BURST_SIZE - 2 * TRIM));
+    }
+
+    /**
+      For delay between readings.
+    */
+    inline void sleep() {
+      if (this->delayTime > 0) {
+        delay(this->delayTime);
+      }
+    }
+};
+
+#endif
@@ -0,0 +1,151 @@
+/**
+  MovingAverageThermistor - class-wrapper allows to average
+  the temperature value of origin Thermistor instance
+  over a sliding window of the latest readings.
+
+  Unlike AverageThermistor, a reading takes only one
+  new reading from the origin and returns the mean of the
+  window: a ring buffer of readings and their running sum,
+  compensated (Kahan summation), so rounding errors
+  of the additions and subtractions do not add up.
+  The window size is a template parameter,
+  so the buffer is sized at compile time.
+
+  Instantiation:
+  Thermistor* thermistor = new MovingAverageThermistor<WINDOW_SIZE>(
+    THERMISTOR
+  );
+
+  Where,
+  THERMISTOR - origin Thermistor instance.
+  WINDOW_SIZE - how many latest readings are averaged.
+
+  Until the window is filled, the mean
+  of the readings taken so far is returned.
+
+  Read temperature:
+  double celsius = thermistor->readCelsius();
+  double kelvin = thermistor->readKelvin();
+  double fahrenheit = thermistor->readFahrenheit();
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef MOVING_AVERAGE_THERMISTOR_H
+#define MOVING_AVERAGE_THERMISTOR_H
+
+#include "Thermistor.h"
+
+template <int WINDOW_SIZE>
+class MovingAverageThermistor final : public Thermistor {
+
+  private:
+    static_assert(WINDOW_SIZE > 0, "WINDOW_SIZE must be positive");
+
+    Thermistor* origin;
+    NTC_Scalar kelvins[WINDOW_SIZE];
+    NTC_Scalar kelvinSum = 0;
+    // Lost low-order part of kelvinSum (Kahan summation).
+    NTC_Scalar compensation = 0;
+    int position = 0;
+    int readingsCount = 0;
+
+  public:
+    /**
+      Constructor
+
+      @param origin - origin Thermistor instance (not NULL)
+    */
+    explicit MovingAverageThermistor(Thermistor* origin) {
+      this->origin = origin;
+    }
+
+    /**
+      Destructor
+      Deletes the origin Thermistor instance.
+    */
+    ~MovingAverageThermistor() {
+      delete this->origin;
+    }
+
+    /**
+      Reads a temperature in Celsius from the thermistor.
+
+      @return average temperature of the window in degree Celsius
+    */
+    NTC_Scalar readCelsius() override {
+      return (readKelvin() - NTC_Scalar(273.15));
+    }
+
+    /**
+      Reads a temperature in Kelvin from the thermistor.
+
+      @return average temperature of the window in degree Kelvin
+    */
+    NTC_Scalar readKelvin() override {
+      return add(this->origin->readKelvin());
+    }
+
+    /**
+      Reads a temperature in Fahrenheit from the thermistor.
+
+      @return average temperature of the window in degree Fahrenheit
+    */
+    NTC_Scalar readFahrenheit() override {
+      return (readCelsius() * NTC_Scalar(1.8) + 32);
+    }
+
+    /**
+      Reads the origin thermistor once, adds its temperature
+      to the window. The analog value and the resistance
+      are of the origin reading.
+
+      @return average thermistor reading of the window
+    */
+    ThermistorReading read() override {
+      const ThermistorReading reading = this->origin->read();
+      return ThermistorReading(add(reading.kelvin), reading.resistance, reading.analog);
+    }
+
+  private:
+    /**
+      Adds the reading to the window in place of the oldest one,
+      a constant number of operations for any window size.
+
+      @param kelvin - temperature in degree Kelvin
+      @return average temperature of the window in degree Kelvin
+    */
+    inline NTC_Scalar add(const NTC_Scalar kelvin) {
+      if (this->readingsCount < WINDOW_SIZE) {
+        ++this->readingsCount;
+      } else {
+        accumulate(-this->kelvins[this->position]);
+      }
+      this->kelvins[this->position] = kelvin;
+      accumulate(kelvin);
+      if (++this->position == WINDOW_SIZE) {
+        this->position = 0;
+      }
+      return (this->kelvinSum / this->readingsCount);
+    }
+
+    /**
+      Adds the value to the running sum and keeps
+      the low-order part lost by the addition,
+      to subtract it from the next value.
+
+      @param value - value to add
+    */
+    inline void accumulate(const NTC_Scalar value) {
+      const NTC_Scalar corrected = value - this->compensation;
+      const NTC_Scalar sum = this->kelvinSum + corrected;
+      this->compensation = (sum - this->kelvinSum) - corrected;
+      this->kelvinSum = sum;
+    }
+};
+
+#endif
@@ -0,0 +1,117 @@
+/**
+  NTC_FastLog - fast approximate logarithms, without libm:
+  in single precision, without branches, so a loop over an array
+  can be vectorized by the compiler (SSE/NEON on a host,
+  Helium/MVE on Cortex-M55...), and in fixed point,
+  for MCUs without FPU.
+
+  log2(x) = E + log2(M), where x = M * 2^E, 1 <= M < 2:
+  E and M are taken from the bits of the value,
+  log2(M) is a polynomial of degree 5 (minimax on 1...2),
+  maximum error 1.5e-5 (log2), 1.0e-5 (ln);
+  the fixed-point one evaluates the same polynomial
+  in Q15 integers, maximum error 1.6e-4 (log2).
+
+  Usage:
+  float value = NTC_FastLog::log2(x);
+  float value = NTC_FastLog::ln(x);
+  int32_t value = NTC_FastLog::log2Fixed(n); // Q15
+
+  Where,
+  x - a positive normal float (no checks of 0, NAN, infinity);
+  n - a positive integer.
+
+  The conversions of the library (NTC_Thermistor, ThermistorBank,
+  the models) use libm log() by default, with the build flag
+  -DNTC_FAST_LOG=1 they use the fast logarithms instead:
+  NTC_FastLog::ln() in floating point and NTC_FastLog::log2Fixed()
+  in readCentiCelsius(). Maximum error of the temperature
+  against libm (NTC 3950, 8 kOhm, 10-bit ADC, -40...150 C):
+  0.0005 K in floating point, 0.0024 K in fixed point;
+  readCentiCelsius() stays within 0.03 C, as with the default
+  logarithm (its error is mostly the Q11 rounding).
+  Values are not checked: a disconnected sensor (analog value 0)
+  reads below absolute zero instead of -273.15 C.
+  See the FastLog example.
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef NTC_FAST_LOG_H
+#define NTC_FAST_LOG_H
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+struct NTC_FastLog final {
+
+  /**
+    @param x - value to calculate (positive normal float)
+    @return approximate base 2 logarithm
+  */
+  static inline float log2(const float x) {
+    uint32_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    const float exponent = (float) ((int32_t) (bits >> 23) - 127);
+    bits = (bits & 0x007FFFFFUL) | 0x3F800000UL;
+    float mantissa;
+    memcpy(&mantissa, &bits, sizeof(mantissa));
+    const float t = mantissa - 1.0f;
+    return exponent + t * (1.44196558f + t * (-0.709662795f +
+      t * (0.417595655f + t * (-0.196269453f + t * 0.0463852808f))));
+  }
+
+  /**
+    @param x - value to calculate (positive normal float)
+    @return approximate natural logarithm
+  */
+  static inline float ln(const float x) {
+    return log2(x) * 0.693147181f;
+  }
+
+  /**
+    Normalizes the value to 1...2 in Q15 (as the exponent and the
+    mantissa of a float) and evaluates the polynomial of log2()
+    in Q15 integers: every product fits in 32 bits.
+
+    @param value - value to calculate (> 0)
+    @return approximate base 2 logarithm in Q15 (15 fraction bits)
+  */
+  static inline int32_t log2Fixed(uint32_t value) {
+    int32_t exponent = 15;
+    while (value >= (1UL << 16)) {
+      value >>= 1;
+      ++exponent;
+    }
+    while (value < (1UL << 15)) {
+      value <<= 1;
+      --exponent;
+    }
+    const int32_t t = (int32_t) value - (1L << 15);
+    int32_t result = 1520;
+    result = -6431 + ((result * t) >> 15);
+    result = 13684 + ((result * t) >> 15);
+    result = -23255 + ((result * t) >> 15);
+    result = 47250 + ((result * t) >> 15);
+    return exponent * (1L << 15) + ((result * t) >> 15);
+  }
+};
+
+/*
+  Natural logarithm of the conversions, see NTC_FAST_LOG,
+  in single precision with NTC_SINGLE_PRECISION (see Thermistor.h).
+*/
+#if defined(NTC_FAST_LOG) && NTC_FAST_LOG
+  #define NTC_LOG(x) NTC_FastLog::ln((float) (x))
+#elif defined(NTC_SINGLE_PRECISION) && NTC_SINGLE_PRECISION
+  #define NTC_LOG(x) logf(x)
+#else
+  #define NTC_LOG(x) log(x)
+#endif
+
+#endif
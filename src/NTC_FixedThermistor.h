@@ -0,0 +1,205 @@
+/**
+  NTC_FixedThermistor - NTC thermistor with parameters
+  fixed at compile time. The lookup table of temperatures
+  is generated by the compiler (constexpr) and stored
+  in PROGMEM (flash), so no temperatures are computed at runtime.
+  The parameters are kept by the thermistor as well, for the resistance
+  of read() and the samples (see NTC_TableThermistor).
+
+  Template parameters:
+  REFERENCE_RESISTANCE - reference resistance (Ohm);
+  NOMINAL_RESISTANCE - nominal resistance at a nominal temperature (Ohm);
+  NOMINAL_TEMPERATURE - nominal temperature in Celsius;
+  B_VALUE - b-value of a thermistor;
+  ADC_RESOLUTION - ADC resolution (default 1023, for Arduion);
+  TABLE_SIZE - number of table entries (default 33);
+  LOWEST_CELSIUS, HIGHEST_CELSIUS - temperature range
+  of the table (default -40...150).
+
+  Instantiation, for example, to NTC 3950 thermistor:
+  Thermistor* thermistor = new NTC_FixedThermistor<8000, 100000, 25, 3950>(A1);
+
+  Can be wrapped as any other Thermistor:
+  Thermistor* thermistor = new SmoothThermistor(
+    new NTC_FixedThermistor<8000, 100000, 25, 3950, 1023, 65, 0, 300>(A1), 5
+  );
+
+  Read temperature:
+    double celsius = thermistor->readCelsius();
+    double kelvin = thermistor->readKelvin();
+    double fahrenheit = thermistor->readFahrenheit();
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef NTC_FIXED_THERMISTOR_H
+#define NTC_FIXED_THERMISTOR_H
+
+#include "NTC_TableThermistor.h"
+
+/**
+  Compile-time list of table indexes 0...N-1.
+*/
+template <unsigned int... INDEXES>
+struct NTC_IndexSequence {};
+
+template <typename FIRST, typename SECOND>
+struct NTC_JoinSequence;
+
+template <unsigned int... FIRST, unsigned int... SECOND>
+struct NTC_JoinSequence<NTC_IndexSequence<FIRST...>, NTC_IndexSequence<SECOND...> > {
+  typedef NTC_IndexSequence<FIRST..., (sizeof...(FIRST) + SECOND)...> type;
+};
+
+/*
+  Splits the sequence in halves to keep the template
+  recursion depth logarithmic for large tables.
+*/
+template <unsigned int N>
+struct NTC_MakeSequence {
+  typedef typename NTC_JoinSequence<
+    typename NTC_MakeSequence<N / 2>::type,
+    typename NTC_MakeSequence<N - N / 2>::type
+  >::type type;
+};
+
+template <>
+struct NTC_MakeSequence<0> {
+  typedef NTC_IndexSequence<> type;
+};
+
+template <>
+struct NTC_MakeSequence<1> {
+  typedef NTC_IndexSequence<0> type;
+};
+
+/**
+  Analog values of the B-value equation evaluated at compile time.
+  Uses the same table layout as NTC_TableThermistor::fillTable(*).
+*/
+template <
+  unsigned long REFERENCE_RESISTANCE,
+  unsigned long NOMINAL_RESISTANCE,
+  int NOMINAL_TEMPERATURE,
+  unsigned int B_VALUE,
+  int ADC_RESOLUTION,
+  int TABLE_SIZE,
+  int LOWEST_CELSIUS,
+  int HIGHEST_CELSIUS
+>
+class NTC_FixedModel {
+
+  private:
+    // Number of terms of the exponent series.
+    static const int EXP_TERMS = 16;
+
+  public:
+    /**
+      Analog value of the table entry.
+
+      @param index - entry index
+      @return analog value
+    */
+    static constexpr double entry(const unsigned int index) {
+      return clamp(
+        kelvinsToAnalog(LOWEST_CELSIUS + 273.15 +
+          (double) index * (HIGHEST_CELSIUS - LOWEST_CELSIUS) / (TABLE_SIZE - 1)),
+        0.5, ADC_RESOLUTION - 0.5
+      );
+    }
+
+  private:
+    static constexpr double kelvinsToAnalog(const double kelvin) {
+      return resistanceToAnalog(kelvinsToResistance(kelvin));
+    }
+
+    static constexpr double resistanceToAnalog(const double resistance) {
+      return ADC_RESOLUTION * resistance / (resistance + REFERENCE_RESISTANCE);
+    }
+
+    static constexpr double kelvinsToResistance(const double kelvin) {
+      return NOMINAL_RESISTANCE *
+        exp(B_VALUE * (1.0 / kelvin - 1.0 / (NOMINAL_TEMPERATURE + 273.15)));
+    }
+
+    static constexpr double clamp(const double x, const double low, const double high) {
+      return (x < low) ? low : ((x > high) ? high : x);
+    }
+
+    /*
+      Exponent: e^x = (e^(x/2))^2 down to |x| <= 0.5,
+      then the Taylor series.
+    */
+    static constexpr double exp(const double x) {
+      return ((x > 0.5) || (x < -0.5)) ? square(exp(x / 2)) : expTerms(x, 1, 0);
+    }
+
+    static constexpr double square(const double x) {
+      return x * x;
+    }
+
+    static constexpr double expTerms(const double x, const double term, const int n) {
+      return (n >= EXP_TERMS) ? 0 : (term + expTerms(x, term * x / (n + 1), n + 1));
+    }
+};
+
+/**
+  PROGMEM table of the model, generated at compile time.
+*/
+template <typename MODEL, typename INDEXES>
+struct NTC_FixedTable;
+
+template <typename MODEL, unsigned int... INDEXES>
+struct NTC_FixedTable<MODEL, NTC_IndexSequence<INDEXES...> > {
+  static constexpr float VALUES[sizeof...(INDEXES)] PROGMEM = {
+    (float) MODEL::entry(INDEXES)...
+  };
+};
+
+template <typename MODEL, unsigned int... INDEXES>
+constexpr float NTC_FixedTable<MODEL, NTC_IndexSequence<INDEXES...> >::VALUES[sizeof...(INDEXES)];
+
+template <
+  unsigned long REFERENCE_RESISTANCE,
+  unsigned long NOMINAL_RESISTANCE,
+  int NOMINAL_TEMPERATURE,
+  unsigned int B_VALUE,
+  int ADC_RESOLUTION = 1023,
+  int TABLE_SIZE = 33,
+  int LOWEST_CELSIUS = -40,
+  int HIGHEST_CELSIUS = 150
+>
+class NTC_FixedThermistor final : public NTC_TableThermistor {
+
+  private:
+    typedef NTC_FixedTable<
+      NTC_FixedModel<
+        REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE,
+        B_VALUE, ADC_RESOLUTION, TABLE_SIZE, LOWEST_CELSIUS, HIGHEST_CELSIUS
+      >,
+      typename NTC_MakeSequence<TABLE_SIZE>::type
+    > Table;
+
+    static_assert(TABLE_SIZE >= 2, "TABLE_SIZE must be at least 2");
+    static_assert(ADC_RESOLUTION > 0, "ADC_RESOLUTION must be positive");
+    static_assert(HIGHEST_CELSIUS > LOWEST_CELSIUS, "HIGHEST_CELSIUS must be above LOWEST_CELSIUS");
+
+  public:
+    /**
+      Constructor
+
+      @param pin - an analog port number to be attached to the thermistor
+    */
+    explicit NTC_FixedThermistor(const int pin) :
+      NTC_TableThermistor(
+        pin, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE,
+        Table::VALUES, TABLE_SIZE, ADC_RESOLUTION, LOWEST_CELSIUS, HIGHEST_CELSIUS
+      ) {
+    }
+};
+
+#endif
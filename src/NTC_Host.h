@@ -0,0 +1,206 @@
+/**
+  NTC_Host - minimal Arduino API for building the library
+  on a host (Linux, macOS, Windows) without Arduino core,
+  for example, to check the conversions on a PC:
+  g++ -Isrc main.cpp src/NTC_Thermistor.cpp ...
+
+  Included by Thermistor.h and AdcSource.h when ARDUINO is not defined.
+
+  Analog ports return scripted values, one by one,
+  starting over after the last one:
+  const int VALUES[] = { 500, 510, 490 };
+  NTC_Host::setAnalogValues(A1, VALUES, 3);
+
+  delay() does not sleep, it moves the clock of millis()
+  and micros() forward, so the timing code runs at full speed.
+  Serial prints to the standard output,
+  Print is the base class of Serial and other outputs.
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef NTC_HOST_H
+#define NTC_HOST_H
+
+#include <chrono>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <type_traits>
+
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define LOW 0x0
+#define HIGH 0x1
+
+#define A0 14
+#define A1 15
+#define A2 16
+#define A3 17
+#define A4 18
+#define A5 19
+#define A6 20
+#define A7 21
+
+// Templates instead of the macros of Arduino core,
+// so standard headers may be included after this one.
+template <typename A, typename B>
+inline typename std::common_type<A, B>::type min(const A a, const B b) {
+  return (a < b) ? a : b;
+}
+
+template <typename A, typename B>
+inline typename std::common_type<A, B>::type max(const A a, const B b) {
+  return (a > b) ? a : b;
+}
+
+template <typename T>
+inline T abs(const T x) {
+  return (x > 0) ? x : -x;
+}
+
+template <typename T, typename L, typename H>
+inline typename std::common_type<T, L, H>::type constrain(const T amt, const L low, const H high) {
+  return (amt < low) ? low : ((amt > high) ? high : amt);
+}
+
+class NTC_Host final {
+
+  public:
+    // Number of analog ports.
+    static const int PINS = 64;
+
+    /**
+      Sets the values returned by analogRead(pin).
+
+      @param pin - an analog port number (0...PINS-1)
+      @param values - values to return (not NULL, not copied)
+      @param length - number of values (> 0)
+    */
+    static void setAnalogValues(const int pin, const int* values, const int length) {
+      Port& port = ports()[pin];
+      port.values = values;
+      port.length = length;
+      port.position = 0;
+    }
+
+    /**
+      @return the next scripted value of the port, 0 if not set
+    */
+    static int nextAnalogValue(const int pin) {
+      Port& port = ports()[pin];
+      if ((port.values == NULL) || (port.length <= 0)) {
+        return 0;
+      }
+      const int value = port.values[port.position];
+      port.position = (port.position + 1) % port.length;
+      return value;
+    }
+
+    /**
+      Moves the clock forward.
+
+      @param us - time in microseconds
+    */
+    static void sleep(const unsigned long us) {
+      clockOffset() += us;
+    }
+
+    /**
+      @return real time plus the time of delay() calls, in microseconds
+    */
+    static unsigned long now() {
+      static const std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+      return (unsigned long) std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start
+      ).count() + clockOffset();
+    }
+
+  private:
+    struct Port {
+      const int* values;
+      int length;
+      int position;
+    };
+
+    static Port* ports() {
+      static Port ports[PINS] = {};
+      return ports;
+    }
+
+    static unsigned long& clockOffset() {
+      static unsigned long offset = 0;
+      return offset;
+    }
+};
+
+inline void pinMode(int, int) {}
+inline void digitalWrite(int, int) {}
+inline int analogRead(const int pin) { return NTC_Host::nextAnalogValue(pin); }
+inline void delay(const unsigned long ms) { NTC_Host::sleep(ms * 1000); }
+inline void delayMicroseconds(const unsigned int us) { NTC_Host::sleep(us); }
+inline unsigned long micros() { return NTC_Host::now(); }
+inline unsigned long millis() { return NTC_Host::now() / 1000; }
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+/**
+  Printing of text and bytes, as Print of Arduino core:
+  implementations write bytes, text is formatted here.
+*/
+class Print {
+
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t data) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size) {
+      size_t written = 0;
+      while (size-- > 0) {
+        written += write(*buffer++);
+      }
+      return written;
+    }
+    size_t write(const char* text) { return write((const uint8_t*) text, strlen(text)); }
+    size_t print(const char* text) { return write(text); }
+    size_t print(const char letter) { return write((uint8_t) letter); }
+    size_t print(const int number) { return format("%d", number); }
+    size_t print(const long number) { return format("%ld", number); }
+    size_t print(const unsigned int number) { return format("%u", number); }
+    size_t print(const unsigned long number) { return format("%lu", number); }
+    size_t print(const double number, const int digits = 2) { return format("%.*f", digits, number); }
+    size_t println() { return write("\n"); }
+    template <typename T>
+    size_t println(const T value) { return print(value) + println(); }
+    size_t println(const double number, const int digits) { return print(number, digits) + println(); }
+
+  private:
+    template <typename... T>
+    size_t format(const char* pattern, const T... values) {
+      char text[32];
+      const int length = snprintf(text, sizeof(text), pattern, values...);
+      return write((const uint8_t*) text, (size_t) min(max(length, 0), (int) sizeof(text) - 1));
+    }
+};
+
+/**
+  Serial printing to the standard output.
+*/
+class NTC_HostSerial final : public Print {
+
+  public:
+    using Print::write;
+    void begin(unsigned long) {}
+    size_t write(const uint8_t data) override { return write(&data, 1); }
+    size_t write(const uint8_t* buffer, const size_t size) override { return fwrite(buffer, 1, size, stdout); }
+};
+
+static NTC_HostSerial Serial;
+
+#endif
@@ -0,0 +1,213 @@
+/**
+  Released into the public domain.
+*/
+#include "NTC_TableThermistor.h"
+
+NTC_TableThermistor::NTC_TableThermistor(
+  const int pin,
+  const double referenceResistance,
+  const double nominalResistance,
+  const double nominalTemperatureCelsius,
+  const double bValue,
+  const int tableSize,
+  const int adcResolution,
+  const double lowestCelsius,
+  const double highestCelsius
+) : NTC_Thermistor(pin, referenceResistance, nominalResistance, nominalTemperatureCelsius, bValue, adcResolution) {
+  setTable(tableSize, lowestCelsius, highestCelsius);
+  buildTable();
+}
+
+NTC_TableThermistor::NTC_TableThermistor(
+  AdcSource* source,
+  const double referenceResistance,
+  const double nominalResistance,
+  const double nominalTemperatureCelsius,
+  const double bValue,
+  const int tableSize,
+  const int adcResolution,
+  const double lowestCelsius,
+  const double highestCelsius
+) : NTC_Thermistor(source, referenceResistance, nominalResistance, nominalTemperatureCelsius, bValue, adcResolution) {
+  setTable(tableSize, lowestCelsius, highestCelsius);
+  buildTable();
+}
+
+NTC_TableThermistor::NTC_TableThermistor(
+  const int pin,
+  const double referenceResistance,
+  ThermistorModel* model,
+  const int tableSize,
+  const int adcResolution,
+  const double lowestCelsius,
+  const double highestCelsius
+) : NTC_Thermistor(pin, referenceResistance, model, adcResolution) {
+  setTable(tableSize, lowestCelsius, highestCelsius);
+  buildTable();
+}
+
+NTC_TableThermistor::NTC_TableThermistor(
+  AdcSource* source,
+  const double referenceResistance,
+  ThermistorModel* model,
+  const int tableSize,
+  const int adcResolution,
+  const double lowestCelsius,
+  const double highestCelsius
+) : NTC_Thermistor(source, referenceResistance, model, adcResolution) {
+  setTable(tableSize, lowestCelsius, highestCelsius);
+  buildTable();
+}
+
+NTC_TableThermistor::NTC_TableThermistor(
+  const int pin,
+  const float* flashTable,
+  const int tableSize,
+  const int adcResolution,
+  const double lowestCelsius,
+  const double highestCelsius
+) : NTC_Thermistor(pin, 0, 0, 0, 0, adcResolution) {
+  setTable(tableSize, lowestCelsius, highestCelsius);
+  this->table = flashTable;
+  this->tableInFlash = true;
+}
+
+NTC_TableThermistor::NTC_TableThermistor(
+  const int pin,
+  const double referenceResistance,
+  const double nominalResistance,
+  const double nominalTemperatureCelsius,
+  const double bValue,
+  const float* flashTable,
+  const int tableSize,
+  const int adcResolution,
+  const double lowestCelsius,
+  const double highestCelsius
+) : NTC_Thermistor(pin, referenceResistance, nominalResistance, nominalTemperatureCelsius, bValue, adcResolution) {
+  setTable(tableSize, lowestCelsius, highestCelsius);
+  this->table = flashTable;
+  this->tableInFlash = true;
+}
+
+NTC_TableThermistor::~NTC_TableThermistor() {
+  if (!this->tableInFlash) {
+    delete[] this->table;
+  }
+}
+
+NTC_Scalar NTC_TableThermistor::readKelvin() {
+  return lookupKelvins(readVoltage());
+}
+
+ThermistorReading NTC_TableThermistor::read() {
+  const NTC_Scalar analog = readVoltage();
+  return ThermistorReading(lookupKelvins(analog), analogToResistance(analog), analog);
+}
+
+/*
+  The table may be in PROGMEM and without the thermistor
+  parameters, so the B-value equation of NTC_Thermistor
+  is not an option here.
+*/
+void NTC_TableThermistor::analogsToKelvins(const uint16_t* analogs, float* kelvins, const int count) {
+  const int highest = this->adcResolution - 1;
+  for (int i = 0; i < count; ++i) {
+    const int analog = constrain((int) analogs[i], 1, highest);
+    kelvins[i] = (float) lookupKelvins(analog);
+  }
+}
+
+NTC_Scalar NTC_TableThermistor::analogToKelvins(const NTC_Scalar analog) {
+  return lookupKelvins(analog);
+}
+
+int32_t NTC_TableThermistor::analogToCentiCelsius(const NTC_Scalar analog) {
+  return kelvinsToCentiCelsius(lookupKelvins(analog));
+}
+
+/*
+  Analog values fall as the temperature rises: finds the entries
+  around the analog value by binary search and interpolates
+  between their temperatures.
+*/
+inline NTC_Scalar NTC_TableThermistor::lookupKelvins(const NTC_Scalar analog) {
+  if (isnan(analog)) {
+    return NAN;
+  }
+  int upper = this->tableSize - 1;
+  if (analog >= tableAt(0)) {
+    return this->lowestKelvin;
+  }
+  if (analog <= tableAt(upper)) {
+    return this->highestKelvin;
+  }
+  // tableAt(lower) > analog >= tableAt(upper).
+  int lower = 0;
+  while (upper - lower > 1) {
+    const int middle = (lower + upper) / 2;
+    if (tableAt(middle) > analog) {
+      lower = middle;
+    } else {
+      upper = middle;
+    }
+  }
+  const NTC_Scalar first = tableAt(lower);
+  return this->lowestKelvin +
+    this->kelvinStep * (lower + (first - analog) / (first - tableAt(upper)));
+}
+
+void NTC_TableThermistor::fillTable(float* table, const int tableSize) {
+  const double step = (double) (this->highestKelvin - this->lowestKelvin) / (tableSize - 1);
+  for (int i = 0; i < tableSize; ++i) {
+    table[i] = kelvinsToAnalog(this->lowestKelvin + i * step);
+  }
+}
+
+/*
+  The equation of NTC_Thermistor (or its model) is not inverted,
+  the analog value is found by bisection, once per entry.
+  Both ends of the analog range mean a shorted or an open
+  thermistor (zero or infinite resistance), so the search stays
+  half an analog value inside the range.
+*/
+float NTC_TableThermistor::kelvinsToAnalog(const double kelvin) {
+  double colder = this->adcResolution - 0.5;
+  double hotter = 0.5;
+  for (int i = 0; i < BISECTION_STEPS; ++i) {
+    const double middle = (colder + hotter) / 2;
+    if (NTC_Thermistor::analogToKelvins(middle) < kelvin) {
+      colder = middle;
+    } else {
+      hotter = middle;
+    }
+  }
+  return (float) ((colder + hotter) / 2);
+}
+
+inline NTC_Scalar NTC_TableThermistor::tableAt(const int index) {
+  return this->tableInFlash ?
+    pgm_read_float(this->table + index) : this->table[index];
+}
+
+inline void NTC_TableThermistor::buildTable() {
+  float* ramTable = new float[this->tableSize];
+  fillTable(ramTable, this->tableSize);
+  this->table = ramTable;
+  this->tableInFlash = false;
+}
+
+/*
+  See about the max(*) function:
+  https://www.arduino.cc/reference/en/language/functions/math/max/
+*/
+inline void NTC_TableThermistor::setTable(
+  const int tableSize,
+  const double lowestCelsius,
+  const double highestCelsius
+) {
+  this->tableSize = max(tableSize, MIN_TABLE_SIZE);
+  const bool valid = (highestCelsius > lowestCelsius);
+  this->lowestKelvin = (NTC_Scalar) ((valid ? lowestCelsius : DEFAULT_LOWEST_CELSIUS) + 273.15);
+  this->highestKelvin = (NTC_Scalar) ((valid ? highestCelsius : DEFAULT_HIGHEST_CELSIUS) + 273.15);
+  this->kelvinStep = (this->highestKelvin - this->lowestKelvin) / (this->tableSize - 1);
+}
@@ -0,0 +1,352 @@
+/**
+  NTC_TableThermistor - NTC thermistor that converts
+  an analog value into a temperature through a lookup table
+  instead of computing the B-value equation on every reading.
+
+  The table holds the analog values of evenly spaced temperatures
+  (-40 C...150 C by default): the lookup finds the pair of entries
+  around an analog value by binary search and interpolates
+  between their temperatures, so the steep end of the curve
+  gets as many entries as the flat one (33 entries are within
+  0.3 C for NTC 3950 with 8k reference resistance).
+  Temperatures out of the range read as its ends.
+  The table is either built once in RAM from the thermistor
+  parameters, or provided by the sketch as a PROGMEM (flash) array.
+
+  Instantiation, RAM table of 33 entries for NTC 3950 thermistor:
+  Thermistor* thermistor = new NTC_TableThermistor(
+    A1, 8000, 100000, 25, 3950, 33
+  );
+
+  Instantiation, RAM table of 65 entries from 0 C to 300 C:
+  Thermistor* thermistor = new NTC_TableThermistor(
+    A1, 8000, 100000, 25, 3950, 65, 1023, 0, 300
+  );
+
+  Instantiation, RAM table of a model (see ThermistorModel):
+  SteinhartHartModel model(A, B, C);
+  Thermistor* thermistor = new NTC_TableThermistor(A1, 8000, &model, 33);
+
+  Instantiation, PROGMEM table:
+  const float TABLE[33] PROGMEM = { ... };
+  Thermistor* thermistor = new NTC_TableThermistor(A1, TABLE, 33);
+
+  The content of a PROGMEM table can be generated
+  with the fillTable(*) method (see LookupTable example).
+
+  Read temperature:
+    double celsius = thermistor->readCelsius();
+    double kelvin = thermistor->readKelvin();
+    double fahrenheit = thermistor->readFahrenheit();
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef NTC_TABLE_THERMISTOR_H
+#define NTC_TABLE_THERMISTOR_H
+
+#include "NTC_Thermistor.h"
+
+#if defined(__AVR__)
+  #include <avr/pgmspace.h>
+#endif
+
+#ifndef PROGMEM
+  #define PROGMEM
+#endif
+
+#ifndef pgm_read_float
+  #define pgm_read_float(address) (*(const float*)(address))
+#endif
+
+class NTC_TableThermistor : public NTC_Thermistor {
+
+  private:
+    // Minimum number of table entries (both ends of the range).
+    static const int MIN_TABLE_SIZE = 2;
+    // Bisection steps of an entry, 1023 / 2^24 of an analog value.
+    static const int BISECTION_STEPS = 24;
+
+    const float* table; // analog values, falling as the temperature rises.
+    int tableSize;
+    bool tableInFlash;
+    // Temperatures of the first and the last entries in Kelvin.
+    NTC_Scalar lowestKelvin;
+    NTC_Scalar highestKelvin;
+    // Temperature step between entries in Kelvin.
+    NTC_Scalar kelvinStep;
+
+  public:
+    // Default temperature range of the table.
+    static constexpr double DEFAULT_LOWEST_CELSIUS = -40;
+    static constexpr double DEFAULT_HIGHEST_CELSIUS = 150;
+
+    /**
+      Constructor
+      Builds the lookup table in RAM.
+
+      @param pin - an analog port number to be attached to the thermistor
+      @param referenceResistance - reference resistance
+      @param nominalResistance - nominal resistance at a nominal temperature
+      @param nominalTemperature - nominal temperature in Celsius
+      @param bValue - b-value of a thermistor
+      @param tableSize - number of table entries (min 2)
+      @param adcResolution - ADC resolution (default 1023, for Arduion)
+      @param lowestCelsius - temperature of the first entry (default -40)
+      @param highestCelsius - temperature of the last entry (default 150)
+    */
+    NTC_TableThermistor(
+      int pin,
+      double referenceResistance,
+      double nominalResistance,
+      double nominalTemperatureCelsius,
+      double bValue,
+      int tableSize,
+      int adcResolution = DEFAULT_ADC_RESOLUTION,
+      double lowestCelsius = DEFAULT_LOWEST_CELSIUS,
+      double highestCelsius = DEFAULT_HIGHEST_CELSIUS
+    );
+
+    /**
+      Constructor
+      Builds the lookup table in RAM,
+      reads analog values from the source.
+
+      @param source - source of analog values (not NULL),
+      not deleted by the thermistor
+      @param referenceResistance - reference resistance
+      @param nominalResistance - nominal resistance at a nominal temperature
+      @param nominalTemperature - nominal temperature in Celsius
+      @param bValue - b-value of a thermistor
+      @param tableSize - number of table entries (min 2)
+      @param adcResolution - ADC resolution (default 1023, for Arduion)
+      @param lowestCelsius - temperature of the first entry (default -40)
+      @param highestCelsius - temperature of the last entry (default 150)
+    */
+    NTC_TableThermistor(
+      AdcSource* source,
+      double referenceResistance,
+      double nominalResistance,
+      double nominalTemperatureCelsius,
+      double bValue,
+      int tableSize,
+      int adcResolution = DEFAULT_ADC_RESOLUTION,
+      double lowestCelsius = DEFAULT_LOWEST_CELSIUS,
+      double highestCelsius = DEFAULT_HIGHEST_CELSIUS
+    );
+
+    /**
+      Constructor
+      Builds the lookup table in RAM by the model
+      instead of the B-value equation.
+
+      @param pin - an analog port number to be attached to the thermistor
+      @param referenceResistance - reference resistance
+      @param model - thermistor model (not NULL),
+      not deleted by the thermistor
+      @param tableSize - number of table entries (min 2)
+      @param adcResolution - ADC resolution (default 1023, for Arduion)
+      @param lowestCelsius - temperature of the first entry (default -40)
+      @param highestCelsius - temperature of the last entry (default 150)
+    */
+    NTC_TableThermistor(
+      int pin,
+      double referenceResistance,
+      ThermistorModel* model,
+      int tableSize,
+      int adcResolution = DEFAULT_ADC_RESOLUTION,
+      double lowestCelsius = DEFAULT_LOWEST_CELSIUS,
+      double highestCelsius = DEFAULT_HIGHEST_CELSIUS
+    );
+
+    /**
+      Constructor
+      Builds the lookup table in RAM by the model,
+      reads analog values from the source.
+
+      @param source - source of analog values (not NULL),
+      not deleted by the thermistor
+      @param referenceResistance - reference resistance
+      @param model - thermistor model (not NULL),
+      not deleted by the thermistor
+      @param tableSize - number of table entries (min 2)
+      @param adcResolution - ADC resolution (default 1023, for Arduion)
+      @param lowestCelsius - temperature of the first entry (default -40)
+      @param highestCelsius - temperature of the last entry (default 150)
+    */
+    NTC_TableThermistor(
+      AdcSource* source,
+      double referenceResistance,
+      ThermistorModel* model,
+      int tableSize,
+      int adcResolution = DEFAULT_ADC_RESOLUTION,
+      double lowestCelsius = DEFAULT_LOWEST_CELSIUS,
+      double highestCelsius = DEFAULT_HIGHEST_CELSIUS
+    );
+
+    /**
+      Constructor
+      Uses the lookup table stored in PROGMEM (flash),
+      filled for the same temperature range (see fillTable(*)).
+
+      @param pin - an analog port number to be attached to the thermistor
+      @param flashTable - PROGMEM table of analog values (not NULL)
+      @param tableSize - number of table entries (min 2)
+      @param adcResolution - ADC resolution (default 1023, for Arduion)
+      @param lowestCelsius - temperature of the first entry (default -40)
+      @param highestCelsius - temperature of the last entry (default 150)
+    */
+    NTC_TableThermistor(
+      int pin,
+      const float* flashTable,
+      int tableSize,
+      int adcResolution = DEFAULT_ADC_RESOLUTION,
+      double lowestCelsius = DEFAULT_LOWEST_CELSIUS,
+      double highestCelsius = DEFAULT_HIGHEST_CELSIUS
+    );
+
+    /**
+      Constructor
+      Uses the lookup table stored in PROGMEM (flash),
+      keeps the thermistor parameters for the resistance
+      and the fixed-point constants.
+
+      @param pin - an analog port number to be attached to the thermistor
+      @param referenceResistance - reference resistance
+      @param nominalResistance - nominal resistance at a nominal temperature
+      @param nominalTemperature - nominal temperature in Celsius
+      @param bValue - b-value of a thermistor
+      @param flashTable - PROGMEM table of analog values (not NULL)
+      @param tableSize - number of table entries (min 2)
+      @param adcResolution - ADC resolution (default 1023, for Arduion)
+      @param lowestCelsius - temperature of the first entry (default -40)
+      @param highestCelsius - temperature of the last entry (default 150)
+    */
+    NTC_TableThermistor(
+      int pin,
+      double referenceResistance,
+      double nominalResistance,
+      double nominalTemperatureCelsius,
+      double bValue,
+      const float* flashTable,
+      int tableSize,
+      int adcResolution = DEFAULT_ADC_RESOLUTION,
+      double lowestCelsius = DEFAULT_LOWEST_CELSIUS,
+      double highestCelsius = DEFAULT_HIGHEST_CELSIUS
+    );
+
+    /**
+      Destructor
+      Deletes the RAM lookup table.
+    */
+    ~NTC_TableThermistor();
+
+    // Owns the RAM table: not copied, pass it by pointer.
+    NTC_TableThermistor(const NTC_TableThermistor&) = delete;
+    NTC_TableThermistor& operator=(const NTC_TableThermistor&) = delete;
+
+    /**
+      Reads a temperature in Kelvin from the thermistor
+      through the lookup table.
+
+      @return temperature in degree Kelvin
+    */
+    NTC_Scalar readKelvin() override;
+
+    /**
+      Reads the analog port once and converts the value
+      into the resistance and, through the lookup table,
+      into the temperature in all units.
+
+      @return thermistor reading
+    */
+    ThermistorReading read() override;
+
+    /**
+      Converts analog values into temperatures in Kelvin
+      through the lookup table, without reading the analog port.
+      Analog values are clamped to 1...ADC-1.
+
+      @param analogs - analog values to convert (not NULL)
+      @param kelvins - temperatures in degree Kelvin to fill (not NULL)
+      @param count - number of values
+    */
+    void analogsToKelvins(const uint16_t* analogs, float* kelvins, int count) override;
+
+    /**
+      Fills the input table with the analog values of evenly
+      spaced temperatures of the range of the thermistor.
+      Can be used to generate the content of a PROGMEM table.
+      Requires an instance created with the thermistor parameters.
+
+      @param table - table to fill (not NULL)
+      @param tableSize - number of table entries (min 2)
+    */
+    void fillTable(float* table, int tableSize);
+
+  protected:
+    /**
+      Converts an analog value into a temperature
+      through the lookup table (samples, see LazySample).
+
+      @param analog - analog value (0...ADC resolution)
+      @return temperature in degree Kelvin
+    */
+    NTC_Scalar analogToKelvins(NTC_Scalar analog) override;
+
+    /**
+      Converts an analog value into a temperature
+      in hundredths of degree Celsius through the lookup table.
+
+      @param analog - analog value (0...ADC resolution)
+      @return temperature in hundredths of degree Celsius,
+      NTC_NO_CENTI_CELSIUS if the analog value is NAN
+    */
+    int32_t analogToCentiCelsius(NTC_Scalar analog) override;
+
+  private:
+    /**
+      Converts an analog value into a temperature
+      through the lookup table.
+
+      @param analog - analog value (0...ADC resolution)
+      @return temperature in degree Kelvin
+    */
+    inline NTC_Scalar lookupKelvins(NTC_Scalar analog);
+
+    /**
+      Finds the analog value of a temperature.
+
+      @param kelvin - temperature in degree Kelvin
+      @return analog value (0.5...ADC resolution - 0.5)
+    */
+    float kelvinsToAnalog(double kelvin);
+
+    /**
+      Reads the table entry.
+
+      @param index - entry index
+      @return analog value
+    */
+    inline NTC_Scalar tableAt(int index);
+
+    /**
+      Builds the lookup table in RAM.
+    */
+    inline void buildTable();
+
+    /**
+      Sets the table size and the temperatures of the entries.
+
+      @param tableSize - number of table entries
+      @param lowestCelsius - temperature of the first entry
+      @param highestCelsius - temperature of the last entry
+    */
+    inline void setTable(int tableSize, double lowestCelsius, double highestCelsius);
+};
+
+#endif
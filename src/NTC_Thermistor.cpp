@@ -19,11 +19,73 @@ NTC_Thermistor::NTC_Thermistor(
 	const int adcResolution
 ) {
 	pinMode(this->pin = pin, INPUT);
+	init(referenceResistance, nominalResistance, nominalTemperatureCelsius, bValue, adcResolution);
+}
+
+NTC_Thermistor::NTC_Thermistor(
+	AdcSource* source,
+	const double referenceResistance,
+	const double nominalResistance,
+	const double nominalTemperatureCelsius,
+	const double bValue,
+	const int adcResolution
+) {
+	this->pin = -1;
+	this->source = source;
+	init(referenceResistance, nominalResistance, nominalTemperatureCelsius, bValue,
+		source->scaleResolution(adcResolution));
+}
+
+NTC_Thermistor::NTC_Thermistor(
+	const int pin,
+	const double referenceResistance,
+	ThermistorModel* model,
+	const int adcResolution
+) {
+	pinMode(this->pin = pin, INPUT);
+	this->model = model;
+	init(referenceResistance, 0, 0, 0, adcResolution);
+}
+
+NTC_Thermistor::NTC_Thermistor(
+	AdcSource* source,
+	const double referenceResistance,
+	ThermistorModel* model,
+	const int adcResolution
+) {
+	this->pin = -1;
+	this->source = source;
+	this->model = model;
+	init(referenceResistance, 0, 0, 0, source->scaleResolution(adcResolution));
+}
+
+void NTC_Thermistor::init(
+	const double referenceResistance,
+	const double nominalResistance,
+	const double nominalTemperatureCelsius,
+	const double bValue,
+	const int adcResolution
+) {
 	this->referenceResistance = referenceResistance;
 	this->nominalResistance = nominalResistance;
 	this->nominalTemperature = celsiusToKelvins(nominalTemperatureCelsius);
 	this->bValue = bValue;
 	this->adcResolution = max(adcResolution, 0);
+	/*
+		The integer conversion is computed in base 2 logarithms,
+		so only the constant parts of the B-value equation
+		are calculated here in floating point, once.
+	*/
+	const double scale = (double) (1L << FIXED_POINT_BITS);
+	const double b2 = bValue / M_LN2;
+	if ((b2 > 0) && (referenceResistance > 0) && (nominalResistance > 0)) {
+		this->fixedPointOffset = (int32_t) floor((b2 / this->nominalTemperature +
+			log(referenceResistance / nominalResistance) / M_LN2) * scale + 0.5);
+		this->fixedPointNumerator = (uint32_t) floor(b2 * 100 * scale + 0.5);
+	} else {
+		this->fixedPointOffset = 0;
+		this->fixedPointNumerator = 0;
+	}
 }
 
 /**
@@ -33,7 +95,7 @@ NTC_Thermistor::NTC_Thermistor(
 
 	@return temperature in Celsius.
 */
-double NTC_Thermistor::readCelsius() {
+NTC_Scalar NTC_Thermistor::readCelsius() {
 	return kelvinsToCelsius(readKelvin());
 }
 
@@ -44,7 +106,7 @@ double NTC_Thermistor::readCelsius() {
 
 	@return temperature in Fahrenheit.
 */
-double NTC_Thermistor::readFahrenheit() {
+NTC_Scalar NTC_Thermistor::readFahrenheit() {
 	return kelvinsToFahrenheit(readKelvin());
 }
 
@@ -55,34 +117,178 @@ double NTC_Thermistor::readFahrenheit() {
 
 	@return temperature in Kelvin.
 */
-double NTC_Thermistor::readKelvin() {
+NTC_Scalar NTC_Thermistor::readKelvin() {
 	return resistanceToKelvins(readResistance());
 }
 
-inline double NTC_Thermistor::resistanceToKelvins(const double resistance) {
-	const double inverseKelvin = 1.0 / this->nominalTemperature +
-		log(resistance / this->nominalResistance) / this->bValue;
-	return (1.0 / inverseKelvin);
+/**
+	Returns a temperature in hundredths of degree Celsius.
+	Reads the voltage and converts it
+	with integer arithmetic only, if it is an integer.
+
+	@return temperature in hundredths of degree Celsius.
+*/
+int32_t NTC_Thermistor::readCentiCelsius() {
+	return analogToCentiCelsius(readVoltage());
 }
 
-inline double NTC_Thermistor::readResistance() {
-	return this->referenceResistance / (this->adcResolution / readVoltage() - 1);
+/**
+	Returns a temperature in all units.
+	Reads the analog value once and converts it
+	into the resistance and the temperature in Kelvin.
+
+	@return thermistor reading.
+*/
+ThermistorReading NTC_Thermistor::read() {
+	const NTC_Scalar analog = readVoltage();
+	const NTC_Scalar resistance = analogToResistance(analog);
+	return ThermistorReading(resistanceToKelvins(resistance), resistance, analog);
+}
+
+/**
+	Returns an unconverted sample.
+	Reads the analog value once.
+
+	@return thermistor sample.
+*/
+LazySample NTC_Thermistor::readSample() {
+	return LazySample(this, readVoltage());
+}
+
+/*
+	1/K = 1/K0 + ln(R/Rn)/B, where R = R0 * V / (ADC - V),
+	1/K = (1/K0 + ln(R0/Rn)/B) + log2(V / (ADC - V)) * ln2/B;
+	The first part is the same for all values.
+*/
+void NTC_Thermistor::analogsToKelvins(const uint16_t* analogs, float* kelvins, const int count) {
+	const float resolution = (float) this->adcResolution;
+	if (this->model != NULL) {
+		for (int i = 0; i < count; ++i) {
+			const float analog = constrain((float) analogs[i], 1.0f, resolution - 1);
+			kelvins[i] = (float) this->model->resistanceToKelvins(analogToResistance(analog));
+		}
+		return;
+	}
+	const float offset = (float) (1.0 / this->nominalTemperature +
+		log(this->referenceResistance / this->nominalResistance) / this->bValue);
+	const float scale = (float) (M_LN2 / this->bValue);
+	// clamped in integers, one bound at a time, so it compiles to min/max instructions.
+	const int32_t highest = this->adcResolution - 1;
+	for (int i = 0; i < count; ++i) {
+		int32_t value = analogs[i];
+		value = (value < 1) ? 1 : value;
+		value = (value > highest) ? highest : value;
+		const float analog = (float) value;
+		kelvins[i] = 1.0f / (offset + NTC_FastLog::log2(analog / (resolution - analog)) * scale);
+	}
+}
+
+NTC_Scalar NTC_Thermistor::resistanceToKelvins(const NTC_Scalar resistance) {
+	if (this->model != NULL) {
+		return this->model->resistanceToKelvins(resistance);
+	}
+	const NTC_Scalar inverseKelvin = 1 / this->nominalTemperature +
+		NTC_LOG(resistance / this->nominalResistance) / this->bValue;
+	return (1 / inverseKelvin);
+}
+
+inline NTC_Scalar NTC_Thermistor::readResistance() {
+	return analogToResistance(readVoltage());
+}
+
+/*
+	The resistance is unknown for a PROGMEM table
+	created without the thermistor parameters.
+*/
+NTC_Scalar NTC_Thermistor::analogToResistance(const NTC_Scalar analog) {
+	if (this->referenceResistance <= 0) {
+		return NAN;
+	}
+	return this->referenceResistance / (this->adcResolution / analog - 1);
 }
 
-inline double NTC_Thermistor::readVoltage() {
-	return analogRead(this->pin);
+NTC_Scalar NTC_Thermistor::analogToKelvins(const NTC_Scalar analog) {
+	return resistanceToKelvins(analogToResistance(analog));
 }
 
-inline double NTC_Thermistor::celsiusToKelvins(const double celsius) {
-	return (celsius + 273.15);
+/*
+	The integer conversion takes an integer analog value,
+	an average is converted in NTC_Scalar not to lose its fraction.
+*/
+int32_t NTC_Thermistor::analogToCentiCelsius(const NTC_Scalar analog) {
+	if ((this->model == NULL) && (floor(analog) == analog)) {
+		return analogToCentiKelvins((int) analog) - 27315;
+	}
+	return kelvinsToCentiCelsius(analogToKelvins(analog));
+}
+
+NTC_Scalar NTC_Thermistor::readVoltage() {
+	return readAnalog();
 }
 
-inline double NTC_Thermistor::kelvinsToCelsius(const double kelvins) {
-	return (kelvins - 273.15);
+int NTC_Thermistor::readAnalog() {
+	return (this->source != NULL) ? this->source->read() : analogRead(this->pin);
 }
 
-inline double NTC_Thermistor::celsiusToFahrenheit(const double celsius) {
-	return (celsius * 1.8 + 32);
+int32_t NTC_Thermistor::analogToCentiKelvins(const int analog) {
+	const int value = constrain(analog, 1, this->adcResolution - 1);
+	const int32_t denominator = this->fixedPointOffset +
+		log2Fixed(value) - log2Fixed(this->adcResolution - value);
+	return (denominator > 0) ?
+		(int32_t) (this->fixedPointNumerator / (uint32_t) denominator) : 0;
+}
+
+/**
+	Integer part is the position of the highest set bit,
+	fraction bits are found one by one by squaring
+	the mantissa normalized to 1...2 (Q15):
+	if the square is >= 2, the next bit is 1.
+	With NTC_FAST_LOG, the polynomial of NTC_FastLog instead.
+*/
+int32_t NTC_Thermistor::log2Fixed(uint32_t value) {
+#if defined(NTC_FAST_LOG) && NTC_FAST_LOG
+	const int32_t shift = 15 - FIXED_POINT_BITS;
+	return (NTC_FastLog::log2Fixed(value) + (1L << (shift - 1))) >> shift;
+#else
+	int32_t exponent = 0;
+	while (value >= (1UL << 16)) {
+		value >>= 1;
+		++exponent;
+	}
+	while (value < (1UL << 15)) {
+		value <<= 1;
+		--exponent;
+	}
+	int32_t result = (exponent + 15) * (1L << FIXED_POINT_BITS);
+	for (int32_t bit = 1L << (FIXED_POINT_BITS - 1); bit > 0; bit >>= 1) {
+		value = (value * value) >> 15;
+		if (value >= (1UL << 16)) {
+			value >>= 1;
+			result += bit;
+		}
+	}
+	return result;
+#endif
+}
+
+int32_t NTC_Thermistor::kelvinsToCentiCelsius(const NTC_Scalar kelvins) {
+	if (isnan(kelvins)) {
+		return NTC_NO_CENTI_CELSIUS;
+	}
+	const NTC_Scalar centiCelsius = (kelvins - NTC_Scalar(273.15)) * 100;
+	return (int32_t) (centiCelsius + ((centiCelsius < 0) ? NTC_Scalar(-0.5) : NTC_Scalar(0.5)));
+}
+
+inline NTC_Scalar NTC_Thermistor::celsiusToKelvins(const NTC_Scalar celsius) {
+	return (celsius + NTC_Scalar(273.15));
+}
+
+inline NTC_Scalar NTC_Thermistor::kelvinsToCelsius(const NTC_Scalar kelvins) {
+	return (kelvins - NTC_Scalar(273.15));
+}
+
+inline NTC_Scalar NTC_Thermistor::celsiusToFahrenheit(const NTC_Scalar celsius) {
+	return (celsius * NTC_Scalar(1.8) + 32);
 }
 
 /**
@@ -92,7 +298,7 @@ inline double NTC_Thermistor::celsiusToFahrenheit(const double celsius) {
 	Then F = C * 1.8 + 32 is Celsius to Fahrenheit conversion.
 	=> Kelvin convert to Celsius, then Celsius to Fahrenheit.
 */
-inline double NTC_Thermistor::kelvinsToFahrenheit(const double kelvins) {
+inline NTC_Scalar NTC_Thermistor::kelvinsToFahrenheit(const NTC_Scalar kelvins) {
 	return celsiusToFahrenheit(kelvinsToCelsius(kelvins));
 }
 
@@ -122,7 +328,11 @@ NTC_Thermistor_ESP32::NTC_Thermistor_ESP32(
  * by reading the millivolts value (which is calibrated by Espressif)
  * and back-calculating the raw ADC count value.
  */
-double NTC_Thermistor_ESP32::readVoltage() {
-	return (double)analogReadMilliVolts(this->pin) / (double)this->vref_mv * this->adcResolution;
+NTC_Scalar NTC_Thermistor_ESP32::readVoltage() {
+	return (NTC_Scalar)analogReadMilliVolts(this->pin) / (NTC_Scalar)this->vref_mv * this->adcResolution;
+}
+
+int NTC_Thermistor_ESP32::readAnalog() {
+	return (int32_t) analogReadMilliVolts(this->pin) * this->adcResolution / this->vref_mv;
 }
 #endif
\ No newline at end of file
@@ -32,6 +32,20 @@
   - optimized constructor;
   - updated documentation.
 
+  v.2.2.0
+  - resistanceToKelvins(*) is available to subclasses
+  (used by NTC_TableThermistor to build its lookup table);
+  - added readCentiCelsius() method with fixed-point conversion;
+  - added readAnalog() method;
+  - added read() method, one analog reading for all units;
+  - added constructor with AdcSource;
+  - added constructors with ThermistorModel;
+  - ADC resolution is scaled by the AdcSource;
+  - added analogsToKelvins(*) method, batch conversion;
+  - fast logarithms with NTC_FAST_LOG (see NTC_FastLog.h);
+  - conversions in NTC_Scalar (see NTC_SINGLE_PRECISION);
+  - implemented SampleThermistor interface, readSample() method.
+
   https://github.com/YuriiSalimov/NTC_Thermistor
 
   Created by Yurii Salimov, February, 2018.
@@ -41,20 +55,33 @@
 #define NTC_THERMISTOR_H
 
 #include "Thermistor.h"
+#include "AdcSource.h"
+#include "ThermistorModel.h"
+#include "NTC_FastLog.h"
+#include "SampleThermistor.h"
 
-class NTC_Thermistor : public Thermistor {
+class NTC_Thermistor : public Thermistor, public SampleThermistor {
 
-  private:
+  // Converts its analog value on demand.
+  friend class LazySample;
+
+  protected:
     // Default analog resolution for Arduino board
     static const int DEFAULT_ADC_RESOLUTION = 1023;
+    // Fraction bits of the fixed-point logarithms.
+    static const int FIXED_POINT_BITS = 11;
 
-  protected:
     int pin; // an analog port.
-    double referenceResistance;
-    double nominalResistance;
-    double nominalTemperature; // in Celsius.
-    double bValue;
+    AdcSource* source = NULL; // analog values instead of the port.
+    ThermistorModel* model = NULL; // instead of the B-value equation.
+    NTC_Scalar referenceResistance;
+    NTC_Scalar nominalResistance;
+    NTC_Scalar nominalTemperature; // in Celsius.
+    NTC_Scalar bValue;
     int adcResolution;
+    // Fixed-point conversion constants, see readCentiCelsius().
+    int32_t fixedPointOffset;
+    uint32_t fixedPointNumerator;
 
   public:
     /**
@@ -76,26 +103,130 @@ class NTC_Thermistor : public Thermistor {
       int adcResolution = DEFAULT_ADC_RESOLUTION
     );
 
+    /**
+      Constructor
+      Reads analog values from the source instead of an analog port.
+
+      @param source - source of analog values (not NULL),
+      not deleted by the thermistor
+      @param referenceResistance - reference resistance
+      @param nominalResistance - nominal resistance at a nominal temperature
+      @param nominalTemperature - nominal temperature in Celsius
+      @param bValue - b-value of a thermistor
+      @param adcResolution - ADC resolution (default 1023, for Arduion),
+      scaled by the source (see AdcSource::scaleResolution())
+    */
+    NTC_Thermistor(
+      AdcSource* source,
+      double referenceResistance,
+      double nominalResistance,
+      double nominalTemperatureCelsius,
+      double bValue,
+      int adcResolution = DEFAULT_ADC_RESOLUTION
+    );
+
+    /**
+      Constructor
+      Converts a resistance by the model
+      instead of the B-value equation.
+
+      @param pin - an analog port number to be attached to the thermistor
+      @param referenceResistance - reference resistance
+      @param model - thermistor model (not NULL),
+      not deleted by the thermistor
+      @param adcResolution - ADC resolution (default 1023, for Arduion)
+    */
+    NTC_Thermistor(
+      int pin,
+      double referenceResistance,
+      ThermistorModel* model,
+      int adcResolution = DEFAULT_ADC_RESOLUTION
+    );
+
+    /**
+      Constructor
+      Reads analog values from the source and converts
+      a resistance by the model.
+
+      @param source - source of analog values (not NULL),
+      not deleted by the thermistor
+      @param referenceResistance - reference resistance
+      @param model - thermistor model (not NULL),
+      not deleted by the thermistor
+      @param adcResolution - ADC resolution (default 1023, for Arduion),
+      scaled by the source (see AdcSource::scaleResolution())
+    */
+    NTC_Thermistor(
+      AdcSource* source,
+      double referenceResistance,
+      ThermistorModel* model,
+      int adcResolution = DEFAULT_ADC_RESOLUTION
+    );
+
     /**
       Reads a temperature in Celsius from the thermistor.
 
       @return temperature in degree Celsius
     */
-    double readCelsius() override;
+    NTC_Scalar readCelsius() override;
 
     /**
       Reads a temperature in Kelvin from the thermistor.
 
       @return temperature in degree Kelvin
     */
-    double readKelvin() override;
+    NTC_Scalar readKelvin() override;
 
     /**
       Reads a temperature in Fahrenheit from the thermistor.
 
       @return temperature in degree Fahrenheit
     */
-    double readFahrenheit() override;
+    NTC_Scalar readFahrenheit() override;
+
+    /**
+      Reads a temperature in hundredths of degree Celsius
+      from the thermistor using integer arithmetic only.
+      Supports b-value up to 14000. With a model or a voltage
+      with a fraction (see readVoltage()), rounds the temperature.
+      See analogToCentiCelsius().
+
+      @return temperature in hundredths of degree Celsius
+    */
+    int32_t readCentiCelsius() override;
+
+    /**
+      Reads the analog port once and converts the value
+      into the resistance and the temperature in all units.
+
+      @return thermistor reading
+    */
+    ThermistorReading read() override;
+
+    /**
+      Reads the analog port once, does not convert the value:
+      the sample converts it on demand (see LazySample).
+
+      @return sample of the thermistor
+    */
+    LazySample readSample() override;
+
+    /**
+      Converts analog values into temperatures in Kelvin,
+      without reading the analog port, for example, the values
+      logged before. Analog values are clamped to 1...ADC-1.
+      Without a model, converts in single precision with the fast
+      logarithm (see NTC_FastLog), the loop has no branches and no
+      calls, so the compiler can vectorize it; the error against
+      readKelvin() is less than 0.001 K up to 150 C.
+      With a model, converts every value by the model.
+      Lookup tables (NTC_TableThermistor) convert through the table.
+
+      @param analogs - analog values to convert (not NULL)
+      @param kelvins - temperatures in degree Kelvin to fill (not NULL)
+      @param count - number of values
+    */
+    virtual void analogsToKelvins(const uint16_t* analogs, float* kelvins, int count);
 
   protected:
     /**
@@ -107,11 +238,12 @@ class NTC_Thermistor : public Thermistor {
       R0 - nominal resistance at a nominal temperature,
       R - the input resistance,
       B - b-value of a thermistor.
+      Or converts by the model, if it is set.
 
       @param resistance - resistance value to convert
       @return temperature in degree Kelvin
     */
-    inline double resistanceToKelvins(double resistance);
+    NTC_Scalar resistanceToKelvins(NTC_Scalar resistance);
 
     /**
       Calculates a resistance of the thermistor:
@@ -124,14 +256,107 @@ class NTC_Thermistor : public Thermistor {
 
       @return resistance of the thermistor sensor.
     */
-    inline double readResistance();
+    inline NTC_Scalar readResistance();
+
+    /**
+      Converts an analog value into a resistance of the thermistor:
+      R = R0 / (ADC / V - 1);
+      See readResistance().
+
+      @param analog - analog value to convert
+      @return resistance of the thermistor sensor,
+      NAN if the reference resistance is unknown (0).
+    */
+    NTC_Scalar analogToResistance(NTC_Scalar analog);
+
+    /**
+      Converts an analog value into a temperature,
+      by the B-value equation or by the model.
+      Implementations with other conversions (lookup tables)
+      override it, so the samples (LazySample) convert
+      the same way as the readings.
+
+      @param analog - analog value to convert
+      @return temperature in degree Kelvin
+    */
+    virtual NTC_Scalar analogToKelvins(NTC_Scalar analog);
+
+    /**
+      Converts an analog value into a temperature
+      in hundredths of degree Celsius: with integer
+      arithmetic only, if the analog value is an integer
+      and there is no model, otherwise rounds analogToKelvins().
+
+      @param analog - analog value to convert
+      @return temperature in hundredths of degree Celsius,
+      NTC_NO_CENTI_CELSIUS if the analog value is NAN
+    */
+    virtual int32_t analogToCentiCelsius(NTC_Scalar analog);
 
     /**
       Reads a voltage from the thermistor analog port.
+      All readings and samples go through it, so implementations
+      override it to read the port otherwise (NTC_Thermistor_ESP32).
 
       @return thermistor voltage in analog range (0...1023, for Arduino).
     */
-    virtual double readVoltage();
+    virtual NTC_Scalar readVoltage();
+
+    /**
+      Reads an integer value from the thermistor analog port
+      or from the source.
+
+      @return thermistor analog value (0...1023, for Arduino).
+    */
+    virtual int readAnalog();
+
+    /**
+      Analog value to temperature conversion in fixed point,
+      the B-value equation in base 2 logarithms:
+      K = (B / ln2) / (B / (K0 * ln2) + log2(R0 / Rn) + log2(V) - log2(ADC - V));
+      Where
+      R0 - reference resistance,
+      Rn - nominal resistance at a nominal temperature,
+      K0 - nominal temperature,
+      ADC - analog port resolution (1023, for Arduino),
+      V - analog value (clamped to 1...ADC-1).
+      Constant parts are precomputed in the constructor.
+
+      @param analog - analog value to convert
+      @return temperature in hundredths of degree Kelvin
+    */
+    int32_t analogToCentiKelvins(int analog);
+
+    /**
+      Sets the thermistor parameters and precomputes
+      the fixed-point conversion constants.
+    */
+    void init(
+      double referenceResistance,
+      double nominalResistance,
+      double nominalTemperatureCelsius,
+      double bValue,
+      int adcResolution
+    );
+
+    /**
+      Base 2 logarithm in fixed point
+      with FIXED_POINT_BITS fraction bits.
+
+      @param value - value to calculate (> 0)
+      @return fixed-point logarithm
+    */
+    static int32_t log2Fixed(uint32_t value);
+
+    /**
+      Rounds a temperature in Kelvin
+      to hundredths of degree Celsius.
+
+      @param kelvins - temperature in degree Kelvin
+      @return temperature in hundredths of degree Celsius,
+      NTC_NO_CENTI_CELSIUS if the temperature is NAN
+    */
+    static int32_t kelvinsToCentiCelsius(NTC_Scalar kelvins);
 
     /**
       Celsius to Kelvin conversion:
@@ -140,7 +365,7 @@ class NTC_Thermistor : public Thermistor {
       @param celsius - temperature in degree Celsius to convert
       @return temperature in degree Kelvin
     */
-    inline double celsiusToKelvins(double celsius);
+    inline NTC_Scalar celsiusToKelvins(NTC_Scalar celsius);
 
     /**
       Kelvin to Celsius conversion:
@@ -149,7 +374,7 @@ class NTC_Thermistor : public Thermistor {
       @param kelvins - temperature in degree Kelvin to convert
       @return temperature in degree Celsius
     */
-    inline double kelvinsToCelsius(double kelvins);
+    inline NTC_Scalar kelvinsToCelsius(NTC_Scalar kelvins);
 
     /**
       Celsius to Fahrenheit conversion:
@@ -158,7 +383,7 @@ class NTC_Thermistor : public Thermistor {
       @param celsius - temperature in degree Celsius to convert
       @return temperature in degree Fahrenheit
     */
-    inline double celsiusToFahrenheit(double celsius);
+    inline NTC_Scalar celsiusToFahrenheit(NTC_Scalar celsius);
 
     /**
       Kelvin to Fahrenheit conversion:
@@ -167,7 +392,7 @@ class NTC_Thermistor : public Thermistor {
       @param kelvins - temperature in degree Kelvin to convert
       @return temperature in degree Fahrenheit
     */
-    inline double kelvinsToFahrenheit(double kelvins);
+    inline NTC_Scalar kelvinsToFahrenheit(NTC_Scalar kelvins);
 };
 
 #if defined(ESP32)
@@ -201,7 +426,14 @@ class NTC_Thermistor_ESP32 : public NTC_Thermistor {
 
       @return thermistor voltage in analog range (0...4095, for ESP32).
     */
-    virtual double readVoltage();
+    virtual NTC_Scalar readVoltage();
+
+    /**
+      Integer version of readVoltage().
+
+      @return thermistor analog value (0...4095, for ESP32).
+    */
+    virtual int readAnalog();
   private:
     // Default analog resolution for Arduino board
     static const int DEFAULT_ESP32_ADC_RESOLUTION = 4095;
@@ -0,0 +1,37 @@
+/**
+  Released into the public domain.
+*/
+#include "OversamplingAdcSource.h"
+
+OversamplingAdcSource::OversamplingAdcSource(AdcSource* origin, const int bits) {
+  this->origin = origin;
+  this->bits = constrain(bits, MIN_BITS, MAX_BITS);
+}
+
+OversamplingAdcSource::~OversamplingAdcSource() {
+  delete this->origin;
+}
+
+/*
+  Values are read by bursts, so sources with a fast
+  readBurst() (e.g. DMA buffers) are not read one by one.
+  The sum is rounded to the nearest value before the shift.
+*/
+int OversamplingAdcSource::read() {
+  int burst[BURST_SIZE];
+  int32_t remaining = 1L << (2 * this->bits);
+  uint32_t sum = 0;
+  while (remaining > 0) {
+    const int count = (int) min(remaining, (int32_t) BURST_SIZE);
+    this->origin->readBurst(burst, count);
+    for (int i = 0; i < count; ++i) {
+      sum += burst[i];
+    }
+    remaining -= count;
+  }
+  return (int) ((sum + (1UL << (this->bits - 1))) >> this->bits);
+}
+
+int OversamplingAdcSource::scaleResolution(const int adcResolution) {
+  return this->origin->scaleResolution(adcResolution) << this->bits;
+}
@@ -0,0 +1,82 @@
+/**
+  OversamplingAdcSource - source-wrapper allows to get
+  extra bits of resolution from origin AdcSource instance
+  by oversampling and decimation:
+  4^BITS analog values are summed in an integer
+  and the sum is shifted right by BITS.
+
+  Unlike AverageThermistor, which converts every reading
+  into a temperature and averages temperatures after log(),
+  analog values are averaged before the conversion,
+  so a reading is converted once and is not biased by log().
+
+  NTC_Thermistor scales the given ADC resolution by the source
+  (see AdcSource::scaleResolution()), so the same ADC resolution
+  is given as for the origin:
+  AdcSource* source = new OversamplingAdcSource(
+    new AnalogAdcSource(A1), BITS
+  );
+  Thermistor* thermistor = new NTC_Thermistor(
+    source, 8000, 100000, 25, 3950, 1023
+  );
+
+  Where,
+  BITS - extra bits of resolution, 1...5 (4...1024 values per reading).
+  Extra bits are real only if the ADC noise is at least of 1 LSB,
+  ADC bits + BITS must be less than bits of "int" (15 on AVR).
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef OVERSAMPLING_ADC_SOURCE_H
+#define OVERSAMPLING_ADC_SOURCE_H
+
+#include "AdcSource.h"
+
+class OversamplingAdcSource final : public AdcSource {
+
+  private:
+    // Minimum extra bits.
+    static const int MIN_BITS = 1;
+    // Maximum extra bits, 1024 values per reading.
+    static const int MAX_BITS = 5;
+    // Values are read by bursts of this size.
+    static const int BURST_SIZE = 16;
+
+    AdcSource* origin;
+    int bits;
+
+  public:
+    /**
+      Constructor
+
+      @param origin - origin AdcSource instance (not NULL)
+      @param bits - extra bits of resolution (1...5)
+    */
+    OversamplingAdcSource(AdcSource* origin, int bits);
+
+    /**
+      Destructor
+      Deletes the origin AdcSource instance.
+    */
+    ~OversamplingAdcSource();
+
+    /**
+      Reads 4^bits analog values of the origin and decimates them.
+
+      @return analog value (0...ADC resolution * 2^bits)
+    */
+    int read() override;
+
+    /**
+      @param adcResolution - ADC resolution of the origin
+      @return ADC resolution * 2^bits
+    */
+    int scaleResolution(int adcResolution) override;
+};
+
+#endif
@@ -0,0 +1,74 @@
+/**
+  Released into the public domain.
+*/
+#include "PiecewiseModel.h"
+
+PiecewiseModel::PiecewiseModel(
+  const double* resistances,
+  const double* celsius,
+  const int pointsNumber
+) {
+  if (pointsNumber < MIN_POINTS_NUMBER) {
+    this->pointsNumber = 0;
+    this->resistances = NULL;
+    this->logResistances = NULL;
+    this->inverseKelvins = NULL;
+    this->slopes = NULL;
+    return;
+  }
+  this->pointsNumber = pointsNumber;
+  this->resistances = new NTC_Scalar[this->pointsNumber];
+  this->logResistances = new NTC_Scalar[this->pointsNumber];
+  this->inverseKelvins = new NTC_Scalar[this->pointsNumber];
+  this->slopes = new NTC_Scalar[this->pointsNumber - 1];
+  // insertion sort by resistance, descending (datasheets are short)
+  for (int i = 0; i < this->pointsNumber; ++i) {
+    const double resistance = resistances[i];
+    const double inverseKelvin = 1.0 / (celsius[i] + 273.15);
+    int j = i;
+    for (; (j > 0) && (this->resistances[j - 1] < resistance); --j) {
+      this->resistances[j] = this->resistances[j - 1];
+      this->inverseKelvins[j] = this->inverseKelvins[j - 1];
+    }
+    this->resistances[j] = resistance;
+    this->inverseKelvins[j] = inverseKelvin;
+  }
+  for (int i = 0; i < this->pointsNumber; ++i) {
+    this->logResistances[i] = log(this->resistances[i]);
+  }
+  for (int i = 0; i < this->pointsNumber - 1; ++i) {
+    const double step = this->logResistances[i + 1] - this->logResistances[i];
+    this->slopes[i] = (step != 0) ?
+      (this->inverseKelvins[i + 1] - this->inverseKelvins[i]) / step : 0;
+  }
+}
+
+PiecewiseModel::~PiecewiseModel() {
+  delete[] this->resistances;
+  delete[] this->logResistances;
+  delete[] this->inverseKelvins;
+  delete[] this->slopes;
+}
+
+NTC_Scalar PiecewiseModel::resistanceToKelvins(const NTC_Scalar resistance) {
+  if (this->pointsNumber == 0) {
+    return NAN;
+  }
+  const int i = findSegment(resistance);
+  return 1 / (this->inverseKelvins[i] +
+    (NTC_LOG(resistance) - this->logResistances[i]) * this->slopes[i]);
+}
+
+inline int PiecewiseModel::findSegment(const NTC_Scalar resistance) {
+  int low = 0;
+  int high = this->pointsNumber - 2;
+  while (low < high) {
+    const int middle = (low + high + 1) / 2;
+    if (this->resistances[middle] >= resistance) {
+      low = middle;
+    } else {
+      high = middle - 1;
+    }
+  }
+  return low;
+}
@@ -0,0 +1,90 @@
+/**
+  PiecewiseModel - thermistor model built from
+  resistance/temperature points of a datasheet.
+
+  Between two neighbouring points, 1/K is linear in ln(R)
+  (a local B-value equation), so the points themselves
+  are exact and few points are needed. Outside the points,
+  the first or the last segment is extended.
+  A reading is a binary search and one logarithm.
+
+  Instantiation:
+  const double CELSIUS[] = { -40, -30, ..., 120 };
+  const double RESISTANCES[] = { 205892, 119563, ..., 515 };
+  ThermistorModel* model = new PiecewiseModel(RESISTANCES, CELSIUS, 17);
+  (the order of SteinhartHartModel::fit()).
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef PIECEWISE_MODEL_H
+#define PIECEWISE_MODEL_H
+
+#include "ThermistorModel.h"
+
+class PiecewiseModel final : public ThermistorModel {
+
+  private:
+    // Minimum number of points (one segment).
+    static const int MIN_POINTS_NUMBER = 2;
+
+    int pointsNumber;
+    // Resistances of the points, descending.
+    NTC_Scalar* resistances;
+    // ln(R) of the points.
+    NTC_Scalar* logResistances;
+    // 1/K of the points.
+    NTC_Scalar* inverseKelvins;
+    // d(1/K) / d(ln(R)) of the segments.
+    NTC_Scalar* slopes;
+
+  public:
+    /**
+      Constructor
+      Sorts the points by resistance and precomputes the segments.
+      With fewer than 2 points the model has no segments
+      and converts any resistance into NAN.
+
+      @param resistances - resistances at the points (not NULL)
+      @param celsius - temperatures of the points in Celsius (not NULL)
+      @param pointsNumber - number of points (>= 2)
+    */
+    PiecewiseModel(
+      const double* resistances,
+      const double* celsius,
+      int pointsNumber
+    );
+
+    /**
+      Destructor
+      Deletes the precomputed points.
+    */
+    ~PiecewiseModel();
+
+    // Owns the points: not copied, pass it by pointer.
+    PiecewiseModel(const PiecewiseModel&) = delete;
+    PiecewiseModel& operator=(const PiecewiseModel&) = delete;
+
+    /**
+      Converts a resistance of the thermistor into a temperature.
+
+      @param resistance - resistance value to convert (> 0)
+      @return temperature in degree Kelvin (NAN without segments)
+    */
+    NTC_Scalar resistanceToKelvins(NTC_Scalar resistance) override;
+
+  private:
+    /**
+      Finds the segment of the resistance.
+
+      @param resistance - resistance value
+      @return index of the first point of the segment
+    */
+    inline int findSegment(NTC_Scalar resistance);
+};
+
+#endif
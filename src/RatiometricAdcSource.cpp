@@ -0,0 +1,73 @@
+/**
+  Released into the public domain.
+*/
+#include "RatiometricAdcSource.h"
+
+RatiometricAdcSource::RatiometricAdcSource(
+  AdcSource* origin,
+  AdcSource* reference,
+  const int referenceNominal,
+  const int refreshPeriod
+) {
+  this->origin = origin;
+  this->reference = reference;
+  this->referenceNominal = max(referenceNominal, 1);
+  this->refreshPeriod = max(refreshPeriod, 1);
+}
+
+RatiometricAdcSource::~RatiometricAdcSource() {
+  delete this->origin;
+  delete this->reference;
+}
+
+/*
+  Values of 16-bit ADCs fit with the factor below 2
+  in 32 bits: 2^16 * 2^16 = 2^32.
+*/
+int RatiometricAdcSource::read() {
+  refresh(1);
+  const uint32_t value = this->origin->read();
+  return (int) ((value * this->gain + (1UL << (GAIN_BITS - 1))) >> GAIN_BITS);
+}
+
+void RatiometricAdcSource::readBurst(int* buffer, const int count) {
+  refresh(count);
+  this->origin->readBurst(buffer, count);
+  for (int i = 0; i < count; ++i) {
+    const uint32_t value = buffer[i];
+    buffer[i] = (int) ((value * this->gain + (1UL << (GAIN_BITS - 1))) >> GAIN_BITS);
+  }
+}
+
+int RatiometricAdcSource::scaleResolution(const int adcResolution) {
+  return this->origin->scaleResolution(adcResolution);
+}
+
+int RatiometricAdcSource::calibrate() {
+  this->referenceNominal = max(this->reference->read(), 1);
+  this->gain = 1UL << GAIN_BITS;
+  this->countdown = this->refreshPeriod;
+  return this->referenceNominal;
+}
+
+int RatiometricAdcSource::getReference() {
+  return (int) ((((uint32_t) this->referenceNominal << GAIN_BITS) + (this->gain >> 1)) / this->gain);
+}
+
+/*
+  The only division of the correction, once per refresh period.
+  A reference of 0 (disconnected channel) keeps the previous factor,
+  the factor is limited below 2 (the supply sagged by half).
+*/
+inline void RatiometricAdcSource::refresh(const int count) {
+  this->countdown -= count;
+  if (this->countdown > 0) {
+    return;
+  }
+  this->countdown = this->refreshPeriod;
+  const uint32_t reference = this->reference->read();
+  if (reference > 0) {
+    const uint32_t gain = (((uint32_t) this->referenceNominal << GAIN_BITS) + (reference >> 1)) / reference;
+    this->gain = min(gain, (uint32_t) ((2UL << GAIN_BITS) - 1));
+  }
+}
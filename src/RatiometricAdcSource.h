@@ -0,0 +1,149 @@
+/**
+  RatiometricAdcSource - source-wrapper allows to correct
+  analog values of origin AdcSource instance for a sagging
+  supply of the divider by a reference channel:
+  V = V * REFERENCE_NOMINAL / REFERENCE;
+
+  NTC_Thermistor assumes that the divider supply equals
+  the ADC reference (or adcVref of NTC_Thermistor_ESP32).
+  When they differ under load, analog values drift together
+  with the reference channel - a channel read by the same ADC
+  that is a fixed value at the nominal supply:
+  - a fixed fraction of the divider supply (e.g. a 1:2 divider),
+  when the ADC reference is fixed (ESP32, external ADC);
+  - the internal bandgap (see BandgapAdcSource, AVR), when
+  the divider is supplied by a regulated rail, but the ADC
+  reference is the sagging supply of the board.
+  With a DMA buffer, the reference channel is another channel
+  of the same scan (see DmaAdcSource).
+
+  The reference is read once per REFRESH_PERIOD analog values
+  and the correction factor is cached, so a reading costs
+  an integer multiplication, not a second conversion.
+
+  Instantiation:
+  AdcSource* source = new RatiometricAdcSource(
+    new AnalogAdcSource(A1),
+    new AnalogAdcSource(A2),
+    REFERENCE_NOMINAL,
+    REFRESH_PERIOD
+  );
+  Thermistor* thermistor = new NTC_Thermistor(
+    source, 8000, 100000, 25, 3950
+  );
+
+  Where,
+  REFERENCE_NOMINAL - analog value of the reference channel at
+  the nominal supply, measured once (see calibrate()) or computed,
+  e.g. 2048 for a 1:2 divider of the supply of a 12-bit ADC.
+  REFRESH_PERIOD - analog values between the reference readings
+  (default 16), the supply changes slower than the temperature.
+
+  Wrap the reference into SmoothAdcSource to smooth its noise.
+  To oversample, wrap this source into OversamplingAdcSource:
+  new OversamplingAdcSource(new RatiometricAdcSource(...), bits),
+  so each raw value is corrected before the decimation;
+  REFRESH_PERIOD then counts raw values, not readings.
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef RATIOMETRIC_ADC_SOURCE_H
+#define RATIOMETRIC_ADC_SOURCE_H
+
+#include "AdcSource.h"
+
+class RatiometricAdcSource final : public AdcSource {
+
+  private:
+    // Fraction bits of the correction factor.
+    static const int GAIN_BITS = 15;
+    // Default analog values between the reference readings.
+    static const int DEFAULT_REFRESH_PERIOD = 16;
+    // Size of the buffer of burst reading.
+    static const int BURST_SIZE = 16;
+
+    AdcSource* origin;
+    AdcSource* reference;
+    int referenceNominal;
+    int refreshPeriod;
+    // Analog values until the next reference reading.
+    int countdown = 0;
+    // Cached correction factor with GAIN_BITS fraction bits.
+    uint32_t gain = 1UL << GAIN_BITS;
+
+  public:
+    /**
+      Constructor
+
+      @param origin - origin AdcSource instance (not NULL)
+      @param reference - AdcSource instance of the reference channel (not NULL)
+      @param referenceNominal - analog value of the reference at the nominal supply (> 0)
+      @param refreshPeriod - analog values between the reference readings (>= 1, default 16)
+    */
+    RatiometricAdcSource(
+      AdcSource* origin,
+      AdcSource* reference,
+      int referenceNominal,
+      int refreshPeriod = DEFAULT_REFRESH_PERIOD
+    );
+
+    /**
+      Destructor
+      Deletes the origin and reference AdcSource instances.
+    */
+    ~RatiometricAdcSource();
+
+    /**
+      Reads an analog value of the origin and corrects it
+      by the cached factor, refreshes the factor when it is time.
+
+      @return corrected analog value
+    */
+    int read() override;
+
+    /**
+      Reads analog values of the origin in a burst
+      and corrects them, the factor is refreshed
+      at most once per burst.
+
+      @param buffer - buffer to fill (not NULL)
+      @param count - number of values to read
+    */
+    void readBurst(int* buffer, int count) override;
+
+    /**
+      @param adcResolution - ADC resolution
+      @return resolution of the origin
+    */
+    int scaleResolution(int adcResolution) override;
+
+    /**
+      Reads the reference channel and takes its value
+      as the nominal, call at the nominal supply.
+
+      @return analog value of the reference at the nominal supply
+    */
+    int calibrate();
+
+    /**
+      @return analog value of the reference
+      of the cached correction factor
+    */
+    int getReference();
+
+  private:
+    /**
+      Reads the reference channel and caches the correction factor
+      when REFRESH_PERIOD analog values are read since the previous reading.
+
+      @param count - number of analog values to read
+    */
+    inline void refresh(int count);
+};
+
+#endif
@@ -0,0 +1,122 @@
+/**
+  SampleRing - single-producer / single-consumer
+  lock-free ring buffer of analog values.
+
+  One context (e.g. a timer interrupt) pushes values,
+  another one (e.g. loop() or an RTOS task) pops them,
+  without disabling interrupts and without locks:
+  the producer writes only "head", the consumer only "tail",
+  and each index is one byte, so it is read and written
+  atomically on 8-bit MCUs too.
+
+  Instantiation:
+  SampleRing<SIZE> ring;
+
+  Where,
+  SIZE - number of slots, a power of two (2...256),
+  holds up to SIZE - 1 values.
+
+  Producer:
+  ring.push(analogRead(A1));
+
+  Consumer:
+  uint16_t value;
+  while (ring.pop(value)) { ... }
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef SAMPLE_RING_H
+#define SAMPLE_RING_H
+
+#if defined(ARDUINO) && (ARDUINO >= 100)
+  #include <Arduino.h>
+#elif defined(ARDUINO)
+  #include <WProgram.h>
+#else
+  #include "NTC_Host.h"
+#endif
+
+/*
+  Orders the memory accesses of the producer and the consumer.
+  Single-core MCUs only need the compiler not to reorder them,
+  ESP32 (dual-core) and host threads need a hardware barrier.
+*/
+#if defined(ESP32) || !defined(ARDUINO)
+  #define NTC_MEMORY_BARRIER() __sync_synchronize()
+#else
+  #define NTC_MEMORY_BARRIER() __asm__ __volatile__("" ::: "memory")
+#endif
+
+template <int SIZE>
+class SampleRing final {
+
+  private:
+    static_assert((SIZE >= 2) && (SIZE <= 256) && ((SIZE & (SIZE - 1)) == 0),
+      "SIZE must be a power of two, 2...256");
+
+    static const uint8_t MASK = (uint8_t) (SIZE - 1);
+
+    volatile uint16_t values[SIZE];
+    // Next slot to write, written by the producer only.
+    volatile uint8_t head = 0;
+    // Next slot to read, written by the consumer only.
+    volatile uint8_t tail = 0;
+    // Values dropped because the ring was full, written by the producer only.
+    volatile uint16_t overruns = 0;
+
+  public:
+    /**
+      Pushes a value, called by the producer only.
+      If the ring is full, the value is dropped.
+
+      @param value - value to push
+      @return true if the value is pushed, false if dropped
+    */
+    inline bool push(const uint16_t value) {
+      const uint8_t current = this->head;
+      const uint8_t next = (uint8_t) ((current + 1) & MASK);
+      if (next == this->tail) {
+        this->overruns = this->overruns + 1;
+        return false;
+      }
+      this->values[current] = value;
+      // the value is written before it is published by the head.
+      NTC_MEMORY_BARRIER();
+      this->head = next;
+      return true;
+    }
+
+    /**
+      Pops the oldest value, called by the consumer only.
+
+      @param value - popped value, if any
+      @return true if a value is popped, false if the ring is empty
+    */
+    inline bool pop(uint16_t& value) {
+      const uint8_t current = this->tail;
+      if (current == this->head) {
+        return false;
+      }
+      // the value is read after the head that published it.
+      NTC_MEMORY_BARRIER();
+      value = this->values[current];
+      NTC_MEMORY_BARRIER();
+      this->tail = (uint8_t) ((current + 1) & MASK);
+      return true;
+    }
+
+    /**
+      @return how many values are dropped because the ring was full
+      (diagnostics, may be torn on 8-bit MCUs)
+    */
+    inline uint16_t getOverruns() const {
+      return this->overruns;
+    }
+};
+
+#endif
@@ -0,0 +1,62 @@
+/**
+  Released into the public domain.
+*/
+#include "SampleThermistor.h"
+#include "NTC_Thermistor.h"
+
+LazySample::LazySample(NTC_Thermistor* converter, const NTC_Scalar analog) {
+  this->converter = converter;
+  this->analog = analog;
+}
+
+LazySample LazySample::withAnalog(const NTC_Scalar analog) const {
+  return LazySample(this->converter, analog);
+}
+
+NTC_Scalar LazySample::getAnalog() const {
+  return this->analog;
+}
+
+NTC_Scalar LazySample::getResistance() {
+  if (!(this->converted & RESISTANCE) && (this->converter != NULL)) {
+    this->resistance = this->converter->analogToResistance(this->analog);
+    this->converted |= RESISTANCE;
+  }
+  return this->resistance;
+}
+
+NTC_Scalar LazySample::getKelvin() {
+  if (!(this->converted & KELVIN) && (this->converter != NULL)) {
+    this->kelvin = this->converter->analogToKelvins(this->analog);
+    this->converted |= KELVIN;
+  }
+  return this->kelvin;
+}
+
+NTC_Scalar LazySample::getCelsius() {
+  return getKelvin() - NTC_Scalar(273.15);
+}
+
+NTC_Scalar LazySample::getFahrenheit() {
+  return getCelsius() * NTC_Scalar(1.8) + 32;
+}
+
+/*
+  Not memoized: the integer conversion is cheap, and the result
+  does not depend on the order of calls.
+*/
+int32_t LazySample::getCentiCelsius() {
+  if ((this->converter == NULL) || isnan(this->analog)) {
+    return NTC_NO_CENTI_CELSIUS;
+  }
+  return this->converter->analogToCentiCelsius(this->analog);
+}
+
+bool LazySample::isConverted() const {
+  return (this->converted & KELVIN) != 0;
+}
+
+ThermistorReading LazySample::toReading() {
+  const NTC_Scalar kelvin = getKelvin();
+  return ThermistorReading(kelvin, getResistance(), this->analog);
+}
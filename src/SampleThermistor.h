@@ -0,0 +1,140 @@
+/**
+  SampleThermistor - interface describes a thermistor
+  that reads samples (LazySample): analog values converted
+  into a temperature only on demand.
+
+  LazySample - the analog value of a reading and the thermistor
+  that converts it. The resistance and the temperature are
+  converted on the first access and kept for the next ones,
+  so code that needs only the analog value (logging, thresholds,
+  averaging) never calls log().
+
+  Implementations:
+  NTC_Thermistor - reads the analog port once per sample;
+  AverageSampleThermistor - averages analog values of samples;
+  SmoothSampleThermistor - smooths analog values of samples.
+  SampleThermistorAdapter gives the Thermistor interface.
+
+  Read a sample:
+  SampleThermistor* thermistor = new AverageSampleThermistor(
+    new NTC_Thermistor(A1, 8000, 100000, 25, 3950), 10
+  );
+  LazySample sample = thermistor->readSample();
+  double analog = sample.getAnalog();   // no conversion
+  double celsius = sample.getCelsius(); // converted once
+  double kelvin = sample.getKelvin();   // already converted
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef SAMPLE_THERMISTOR_H
+#define SAMPLE_THERMISTOR_H
+
+#include "Thermistor.h"
+
+class NTC_Thermistor;
+
+class LazySample final {
+
+  private:
+    // Flags of the converted values.
+    static const uint8_t RESISTANCE = 1;
+    static const uint8_t KELVIN = 2;
+
+    NTC_Thermistor* converter;
+    NTC_Scalar analog;
+    NTC_Scalar resistance = NAN;
+    NTC_Scalar kelvin = NAN;
+    uint8_t converted = 0;
+
+  public:
+    /**
+      Constructor
+
+      @param converter - thermistor that converts the analog value
+      (NULL, for an empty sample: all values are NAN)
+      @param analog - analog value (NAN, if unknown)
+    */
+    explicit LazySample(NTC_Thermistor* converter = NULL, NTC_Scalar analog = NAN);
+
+    /**
+      Returns an unconverted sample of other analog value
+      and the same converter, for example, an average.
+
+      @param analog - analog value
+      @return new sample
+    */
+    LazySample withAnalog(NTC_Scalar analog) const;
+
+    /**
+      @return analog value, never converts
+    */
+    NTC_Scalar getAnalog() const;
+
+    /**
+      @return resistance of the thermistor, converted on the first call
+      (NAN if the converter has no reference resistance)
+    */
+    NTC_Scalar getResistance();
+
+    /**
+      @return temperature in degree Kelvin, converted on the first call
+    */
+    NTC_Scalar getKelvin();
+
+    /**
+      @return temperature in degree Celsius, converted on the first call
+    */
+    NTC_Scalar getCelsius();
+
+    /**
+      @return temperature in degree Fahrenheit, converted on the first call
+    */
+    NTC_Scalar getFahrenheit();
+
+    /**
+      Returns the temperature in hundredths of degree Celsius,
+      converted as readCentiCelsius() of the converter: in integers
+      if the analog value is an integer and there is no model
+      (NTC_Thermistor), through the lookup table (NTC_TableThermistor),
+      otherwise rounds getCelsius().
+
+      @return temperature in hundredths of degree Celsius,
+      NTC_NO_CENTI_CELSIUS for an empty sample
+    */
+    int32_t getCentiCelsius();
+
+    /**
+      @return true if the temperature is converted
+    */
+    bool isConverted() const;
+
+    /**
+      @return the sample in all units, converts it if not yet
+    */
+    ThermistorReading toReading();
+};
+
+class SampleThermistor {
+
+  public:
+
+    /**
+      Destructor
+      Deletes SampleThermistor instance.
+    */
+    virtual ~SampleThermistor() {};
+
+    /**
+      Reads a sample, does not convert it.
+
+      @return sample
+    */
+    virtual LazySample readSample() = 0;
+};
+
+#endif
@@ -0,0 +1,32 @@
+/**
+  Released into the public domain.
+*/
+#include "SampleThermistorAdapter.h"
+
+SampleThermistorAdapter::SampleThermistorAdapter(SampleThermistor* origin) {
+  this->origin = origin;
+}
+
+SampleThermistorAdapter::~SampleThermistorAdapter() {
+  delete this->origin;
+}
+
+NTC_Scalar SampleThermistorAdapter::readCelsius() {
+  return this->origin->readSample().getCelsius();
+}
+
+NTC_Scalar SampleThermistorAdapter::readKelvin() {
+  return this->origin->readSample().getKelvin();
+}
+
+NTC_Scalar SampleThermistorAdapter::readFahrenheit() {
+  return this->origin->readSample().getFahrenheit();
+}
+
+int32_t SampleThermistorAdapter::readCentiCelsius() {
+  return this->origin->readSample().getCentiCelsius();
+}
+
+ThermistorReading SampleThermistorAdapter::read() {
+  return this->origin->readSample().toReading();
+}
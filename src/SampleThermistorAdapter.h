@@ -0,0 +1,91 @@
+/**
+  SampleThermistorAdapter - adapts a SampleThermistor
+  (AverageSampleThermistor, SmoothSampleThermistor...)
+  to the Thermistor interface: every reading takes a sample
+  and converts it once into the requested units.
+
+  Instantiation:
+  Thermistor* thermistor = new SampleThermistorAdapter(
+    new SmoothSampleThermistor(
+      new AverageSampleThermistor(
+        new NTC_Thermistor(A1, 8000, 100000, 25, 3950), 10
+      ), 4
+    )
+  );
+
+  Read temperature:
+  double celsius = thermistor->readCelsius();
+  double kelvin = thermistor->readKelvin();
+  double fahrenheit = thermistor->readFahrenheit();
+  int32_t centiCelsius = thermistor->readCentiCelsius();
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef SAMPLE_THERMISTOR_ADAPTER_H
+#define SAMPLE_THERMISTOR_ADAPTER_H
+
+#include "Thermistor.h"
+#include "SampleThermistor.h"
+
+class SampleThermistorAdapter final : public Thermistor {
+
+  private:
+    SampleThermistor* origin;
+
+  public:
+    /**
+      Constructor
+
+      @param origin - origin SampleThermistor instance (not NULL)
+    */
+    explicit SampleThermistorAdapter(SampleThermistor* origin);
+
+    /**
+      Destructor
+      Deletes the origin SampleThermistor instance.
+    */
+    ~SampleThermistorAdapter();
+
+    /**
+      Reads a sample and converts it in Celsius.
+
+      @return temperature in degree Celsius
+    */
+    NTC_Scalar readCelsius() override;
+
+    /**
+      Reads a sample and converts it in Kelvin.
+
+      @return temperature in degree Kelvin
+    */
+    NTC_Scalar readKelvin() override;
+
+    /**
+      Reads a sample and converts it in Fahrenheit.
+
+      @return temperature in degree Fahrenheit
+    */
+    NTC_Scalar readFahrenheit() override;
+
+    /**
+      Reads a sample and converts it in hundredths
+      of degree Celsius (see LazySample::getCentiCelsius()).
+
+      @return temperature in hundredths of degree Celsius
+    */
+    int32_t readCentiCelsius() override;
+
+    /**
+      Reads a sample and converts it in all units.
+
+      @return thermistor reading
+    */
+    ThermistorReading read() override;
+};
+
+#endif
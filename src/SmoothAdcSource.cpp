@@ -0,0 +1,37 @@
+/**
+  Released into the public domain.
+*/
+#include "SmoothAdcSource.h"
+
+SmoothAdcSource::SmoothAdcSource(AdcSource* origin, const int shift) {
+  this->origin = origin;
+  this->shift = constrain(shift, MIN_SHIFT, MAX_SHIFT);
+}
+
+SmoothAdcSource::~SmoothAdcSource() {
+  delete this->origin;
+}
+
+/*
+  The state keeps "shift" fraction bits, so the smoothing
+  does not lose the values smaller than 2^shift:
+  state += V - S; S = round(state / 2^shift).
+  The same rounded S in both, so the smoothing settles
+  at V from above as from below.
+  The first value starts the smoothing as is.
+*/
+int SmoothAdcSource::read() {
+  const int32_t value = this->origin->read();
+  const int32_t half = 1L << (this->shift - 1);
+  if (this->smoothing) {
+    this->state += value - ((this->state + half) >> this->shift);
+  } else {
+    this->state = value << this->shift;
+    this->smoothing = true;
+  }
+  return (int) ((this->state + half) >> this->shift);
+}
+
+int SmoothAdcSource::scaleResolution(const int adcResolution) {
+  return this->origin->scaleResolution(adcResolution);
+}
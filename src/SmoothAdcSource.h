@@ -0,0 +1,81 @@
+/**
+  SmoothAdcSource - source-wrapper allows to smooth
+  analog values of origin AdcSource instance
+  by integer exponential smoothing:
+  S = S + (V - S) / 2^SHIFT;
+
+  Smoothing happens once, on the analog value, before
+  the conversion, so Celsius, Kelvin and Fahrenheit of the
+  thermistor are derived from one smoothed value. Only integer
+  additions and shifts, no division, no floating point.
+
+  Instantiation:
+  AdcSource* source = new SmoothAdcSource(
+    new AnalogAdcSource(A1), SHIFT
+  );
+  Thermistor* thermistor = new NTC_Thermistor(
+    source, 8000, 100000, 25, 3950
+  );
+
+  Where,
+  SHIFT - smoothing factor as a power of two, 1...15:
+  2 is like SmoothThermistor with factor 4, 3 - factor 8...
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef SMOOTH_ADC_SOURCE_H
+#define SMOOTH_ADC_SOURCE_H
+
+#include "AdcSource.h"
+
+class SmoothAdcSource final : public AdcSource {
+
+  private:
+    // Minimum smoothing shift.
+    static const int MIN_SHIFT = 1;
+    // Maximum smoothing shift, 16-bit values fit in 32-bit state.
+    static const int MAX_SHIFT = 15;
+    // Default smoothing shift (factor 4).
+    static const int DEFAULT_SHIFT = 2;
+
+    AdcSource* origin;
+    int shift;
+    // Smoothed value with "shift" fraction bits.
+    int32_t state = 0;
+    bool smoothing = false;
+
+  public:
+    /**
+      Constructor
+
+      @param origin - origin AdcSource instance (not NULL)
+      @param shift - smoothing factor as a power of two (1...15, default, 2)
+    */
+    SmoothAdcSource(AdcSource* origin, int shift = DEFAULT_SHIFT);
+
+    /**
+      Destructor
+      Deletes the origin AdcSource instance.
+    */
+    ~SmoothAdcSource();
+
+    /**
+      Reads an analog value of the origin and smooths it.
+
+      @return smoothed analog value
+    */
+    int read() override;
+
+    /**
+      @param adcResolution - ADC resolution
+      @return resolution of the origin
+    */
+    int scaleResolution(int adcResolution) override;
+};
+
+#endif
@@ -0,0 +1,24 @@
+/**
+  Released into the public domain.
+*/
+#include "SmoothSampleThermistor.h"
+
+SmoothSampleThermistor::SmoothSampleThermistor(
+  SampleThermistor* origin,
+  const int smoothingFactor
+) {
+  this->origin = origin;
+  this->smoothingFactor = max(smoothingFactor, MIN_SMOOTHING_FACTOR);
+}
+
+SmoothSampleThermistor::~SmoothSampleThermistor() {
+  delete this->origin;
+}
+
+LazySample SmoothSampleThermistor::readSample() {
+  const LazySample sample = this->origin->readSample();
+  const NTC_Scalar input = sample.getAnalog();
+  this->analog = isnan(this->analog) ? input :
+    ((this->analog * (this->smoothingFactor - 1) + input) / this->smoothingFactor);
+  return sample.withAnalog(this->analog);
+}
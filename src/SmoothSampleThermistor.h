@@ -0,0 +1,72 @@
+/**
+  SmoothSampleThermistor - class-wrapper allows to smooth
+  analog values of samples of origin SampleThermistor instance.
+
+  Unlike SmoothThermistor, which converts every reading,
+  the analog value is smoothed and converted on demand
+  (see LazySample).
+
+  Instantiation:
+  SampleThermistor* thermistor = new SmoothSampleThermistor(
+    SAMPLE_THERMISTOR, SMOOTH_FACTOR
+  );
+
+  Where,
+  SAMPLE_THERMISTOR - origin SampleThermistor instance
+  (NTC_Thermistor, AverageSampleThermistor...).
+  SMOOTH_FACTOR - smoothing factor of an analog value (>= 2, default 2).
+
+  Read a sample:
+  LazySample sample = thermistor->readSample();
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef SMOOTH_SAMPLE_THERMISTOR_H
+#define SMOOTH_SAMPLE_THERMISTOR_H
+
+#include "SampleThermistor.h"
+
+class SmoothSampleThermistor final : public SampleThermistor {
+
+  private:
+    // Minimum smoothing factor.
+    static const int MIN_SMOOTHING_FACTOR = 2;
+
+    SampleThermistor* origin;
+    int smoothingFactor;
+    // NAN until the first sample.
+    NTC_Scalar analog = NAN;
+
+  public:
+    /**
+      Constructor
+
+      @param origin - origin SampleThermistor instance (not NULL)
+      @param smoothingFactor - smoothing factor of an analog value (default, 2)
+    */
+    SmoothSampleThermistor(
+      SampleThermistor* origin,
+      int smoothingFactor = MIN_SMOOTHING_FACTOR
+    );
+
+    /**
+      Destructor
+      Deletes the origin SampleThermistor instance.
+    */
+    ~SmoothSampleThermistor();
+
+    /**
+      Reads a sample of the origin and smooths
+      its analog value, does not convert it.
+
+      @return sample of the smoothed analog value
+    */
+    LazySample readSample() override;
+};
+
+#endif
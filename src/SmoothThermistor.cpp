@@ -16,32 +16,32 @@ SmoothThermistor::~SmoothThermistor() {
   delete this->origin;
 }
 
-double SmoothThermistor::readCelsius() {
-  return this->celsius = smoothe(
-    this->origin->readCelsius(),
-    this->celsius
-  );
+NTC_Scalar SmoothThermistor::readCelsius() {
+  return (readKelvin() - NTC_Scalar(273.15));
 }
 
-double SmoothThermistor::readKelvin() {
+NTC_Scalar SmoothThermistor::readKelvin() {
   return this->kelvin = smoothe(
     this->origin->readKelvin(),
     this->kelvin
   );
 }
 
-double SmoothThermistor::readFahrenheit() {
-  return this->fahrenheit = smoothe(
-    this->origin->readFahrenheit(),
-    this->fahrenheit
-  );
+NTC_Scalar SmoothThermistor::readFahrenheit() {
+  return (readCelsius() * NTC_Scalar(1.8) + 32);
+}
+
+ThermistorReading SmoothThermistor::read() {
+  const ThermistorReading reading = this->origin->read();
+  this->kelvin = smoothe(reading.kelvin, this->kelvin);
+  return ThermistorReading(this->kelvin, reading.resistance, reading.analog);
 }
 
-inline double SmoothThermistor::smoothe(
-  const double input,
-  const double data
+inline NTC_Scalar SmoothThermistor::smoothe(
+  const NTC_Scalar input,
+  const NTC_Scalar data
 ) {
-  return (data == 0) ? input :
+  return isnan(data) ? input :
     ((data * (this->smoothingFactor - 1) + input) / this->smoothingFactor);
 }
 
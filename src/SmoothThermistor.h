@@ -28,6 +28,14 @@
   v.2.0.3
   - replaced "define" constants with "static const"
 
+  v.2.2.0
+  - added read() method;
+  - smooths one temperature in Kelvin, Celsius and Fahrenheit
+  are derived from it, each reading steps the smoothing once;
+  - fixed reset of smoothing by a 0 temperature
+  (see also SmoothAdcSource for integer smoothing of analog values);
+  - smooths in NTC_Scalar (see NTC_SINGLE_PRECISION).
+
   https://github.com/YuriiSalimov/NTC_Thermistor
 
   Created by Yurii Salimov, May, 2019.
@@ -46,9 +54,8 @@ class SmoothThermistor final : public Thermistor {
 
     Thermistor* origin;
     int smoothingFactor;
-    double celsius = 0;
-    double kelvin = 0;
-    double fahrenheit = 0;
+    // Smoothed temperature in Kelvin, NAN until the first reading.
+    NTC_Scalar kelvin = NAN;
 
   public:
     /**
@@ -71,23 +78,32 @@ class SmoothThermistor final : public Thermistor {
     /**
       Reads a temperature in Celsius from the thermistor.
 
-      @return average temperature in degree Celsius
+      @return smoothed temperature in degree Celsius
     */
-    double readCelsius() override;
+    NTC_Scalar readCelsius() override;
 
     /**
       Reads a temperature in Kelvin from the thermistor.
 
       @return smoothed temperature in degree Kelvin
     */
-    double readKelvin() override;
+    NTC_Scalar readKelvin() override;
 
     /**
       Reads a temperature in Fahrenheit from the thermistor.
 
       @return smoothed temperature in degree Fahrenheit
     */
-    double readFahrenheit() override;
+    NTC_Scalar readFahrenheit() override;
+
+    /**
+      Reads the origin thermistor once and smooths
+      the temperature in Kelvin. The analog value
+      and the resistance are of the origin reading.
+
+      @return smoothed thermistor reading
+    */
+    ThermistorReading read() override;
 
   private:
     /**
@@ -96,9 +112,9 @@ class SmoothThermistor final : public Thermistor {
       @param input - the value to smooth
       @param data - the data for smoothing of the input value
       @return smoothed value or the input value
-      if the input data is 0.
+      if there is no data yet (NAN).
     */
-    inline double smoothe(double input, double data);
+    inline NTC_Scalar smoothe(NTC_Scalar input, NTC_Scalar data);
 
     /**
       Sets the smoothing factor.
@@ -0,0 +1,134 @@
+/**
+  StaticAverageThermistor - class-wrapper allows to average
+  the temperature value of origin thermistor, composed by value:
+  no heap, no virtual calls, the calls can be inlined.
+
+  Template parameters:
+  ORIGIN - origin thermistor class (NTC_Thermistor,
+  NTC_FixedThermistor, StaticSmoothThermistor, ...);
+  READINGS_NUMBER - how many readings are taken
+  to determine a mean temperature (default, 10);
+  DELAY_TIME - delay time between readings, ms (default, 1).
+
+  Instantiation, the constructor arguments are of the origin:
+  StaticAverageThermistor<NTC_Thermistor, 10, 1> thermistor(
+    A1, 8000, 100000, 25, 3950
+  );
+
+  Nested, smoothing of average temperatures:
+  StaticSmoothThermistor<
+    StaticAverageThermistor<NTC_Thermistor, 10, 1>, 5
+  > thermistor(A1, 8000, 100000, 25, 3950);
+
+  Where Thermistor interface is needed, see ThermistorAdapter.
+
+  Read temperature:
+    double celsius = thermistor.readCelsius();
+    double kelvin = thermistor.readKelvin();
+    double fahrenheit = thermistor.readFahrenheit();
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef STATIC_AVERAGE_THERMISTOR_H
+#define STATIC_AVERAGE_THERMISTOR_H
+
+#include "Thermistor.h"
+
+template <typename ORIGIN, int READINGS_NUMBER = 10, int DELAY_TIME = 1>
+class StaticAverageThermistor final {
+
+  private:
+    static_assert(READINGS_NUMBER > 0, "READINGS_NUMBER must be positive");
+    static_assert(DELAY_TIME >= 0, "DELAY_TIME must not be negative");
+
+    ORIGIN origin;
+
+  public:
+    /**
+      Constructor
+
+      @param args - constructor arguments of the origin thermistor
+    */
+    template <typename... ARGS>
+    explicit StaticAverageThermistor(ARGS... args) : origin(args...) {}
+
+    /**
+      @return average temperature in degree Celsius
+    */
+    NTC_Scalar readCelsius() {
+      return read().celsius;
+    }
+
+    /**
+      @return average temperature in degree Kelvin
+    */
+    NTC_Scalar readKelvin() {
+      return read().kelvin;
+    }
+
+    /**
+      @return average temperature in degree Fahrenheit
+    */
+    NTC_Scalar readFahrenheit() {
+      return read().fahrenheit;
+    }
+
+    /**
+      @return average temperature in hundredths of degree Celsius,
+      rounded (NTC_NO_CENTI_CELSIUS if a reading is unknown)
+    */
+    int32_t readCentiCelsius() {
+      int32_t sum = 0;
+      for (int i = 0; i < READINGS_NUMBER; ++i) {
+        const int32_t centiCelsius = this->origin.readCentiCelsius();
+        if (centiCelsius == NTC_NO_CENTI_CELSIUS) {
+          return NTC_NO_CENTI_CELSIUS;
+        }
+        sum += centiCelsius;
+        sleep();
+      }
+      return (sum + ((sum < 0) ? -(READINGS_NUMBER / 2) : (READINGS_NUMBER / 2))) / READINGS_NUMBER;
+    }
+
+    /**
+      Reads the origin thermistor READINGS_NUMBER times,
+      averages the analog value, the resistance
+      and the temperature at once.
+
+      @return average thermistor reading
+    */
+    ThermistorReading read() {
+      NTC_Scalar analogSum = 0;
+      NTC_Scalar resistanceSum = 0;
+      NTC_Scalar kelvinSum = 0;
+      for (int i = 0; i < READINGS_NUMBER; ++i) {
+        const ThermistorReading reading = this->origin.read();
+        analogSum += reading.analog;
+        resistanceSum += reading.resistance;
+        kelvinSum += reading.kelvin;
+        sleep();
+      }
+      return ThermistorReading(
+        kelvinSum / READINGS_NUMBER,
+        resistanceSum / READINGS_NUMBER,
+        analogSum / READINGS_NUMBER
+      );
+    }
+
+  private:
+    /**
+      For delay between readings.
+    */
+    inline void sleep() {
+      if (DELAY_TIME > 0) {
+        delay(DELAY_TIME);
+      }
+    }
+};
+
+#endif
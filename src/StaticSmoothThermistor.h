@@ -0,0 +1,106 @@
+/**
+  StaticSmoothThermistor - class-wrapper allows to smooth
+  the temperature value of origin thermistor, composed by value:
+  no heap, no virtual calls, the calls can be inlined.
+  Smooths the temperature in Kelvin once, Celsius and
+  Fahrenheit are derived from it.
+
+  Template parameters:
+  ORIGIN - origin thermistor class (NTC_Thermistor,
+  NTC_FixedThermistor, StaticAverageThermistor, ...);
+  SMOOTHING_FACTOR - smoothing factor of a temperature value
+  (min and default, 2).
+
+  Instantiation, the constructor arguments are of the origin:
+  StaticSmoothThermistor<NTC_Thermistor, 5> thermistor(
+    A1, 8000, 100000, 25, 3950
+  );
+
+  Where Thermistor interface is needed, see ThermistorAdapter.
+
+  Read temperature:
+    double celsius = thermistor.readCelsius();
+    double kelvin = thermistor.readKelvin();
+    double fahrenheit = thermistor.readFahrenheit();
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef STATIC_SMOOTH_THERMISTOR_H
+#define STATIC_SMOOTH_THERMISTOR_H
+
+#include "Thermistor.h"
+
+template <typename ORIGIN, int SMOOTHING_FACTOR = 2>
+class StaticSmoothThermistor final {
+
+  private:
+    static_assert(SMOOTHING_FACTOR >= 2, "SMOOTHING_FACTOR must be at least 2");
+
+    ORIGIN origin;
+    // NAN until the first reading and after an unknown one.
+    NTC_Scalar kelvin = NAN;
+
+  public:
+    /**
+      Constructor
+
+      @param args - constructor arguments of the origin thermistor
+    */
+    template <typename... ARGS>
+    explicit StaticSmoothThermistor(ARGS... args) : origin(args...) {}
+
+    /**
+      @return smoothed temperature in degree Celsius
+    */
+    NTC_Scalar readCelsius() {
+      return read().celsius;
+    }
+
+    /**
+      @return smoothed temperature in degree Kelvin
+    */
+    NTC_Scalar readKelvin() {
+      return read().kelvin;
+    }
+
+    /**
+      @return smoothed temperature in degree Fahrenheit
+    */
+    NTC_Scalar readFahrenheit() {
+      return read().fahrenheit;
+    }
+
+    /**
+      @return smoothed temperature in hundredths of degree Celsius,
+      NTC_NO_CENTI_CELSIUS if the temperature is unknown (NAN)
+    */
+    int32_t readCentiCelsius() {
+      const NTC_Scalar celsius = readCelsius();
+      if (isnan(celsius)) {
+        return NTC_NO_CENTI_CELSIUS;
+      }
+      return (int32_t) (celsius * 100 + ((celsius < 0) ? NTC_Scalar(-0.5) : NTC_Scalar(0.5)));
+    }
+
+    /**
+      Reads the origin thermistor once and smooths
+      the temperature. The analog value and the resistance
+      are of the origin reading. An unknown temperature (NAN)
+      restarts the smoothing with the next reading.
+
+      @return smoothed thermistor reading
+    */
+    ThermistorReading read() {
+      const ThermistorReading reading = this->origin.read();
+      this->kelvin = isnan(this->kelvin) ? reading.kelvin :
+        ((this->kelvin * (SMOOTHING_FACTOR - 1) + reading.kelvin) / SMOOTHING_FACTOR);
+      return ThermistorReading(this->kelvin, reading.resistance, reading.analog);
+    }
+};
+
+#endif
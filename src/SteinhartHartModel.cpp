@@ -0,0 +1,75 @@
+/**
+  Released into the public domain.
+*/
+#include "SteinhartHartModel.h"
+
+SteinhartHartModel::SteinhartHartModel(
+  const double a,
+  const double b,
+  const double c
+) {
+  this->a = a;
+  this->b = b;
+  this->c = c;
+}
+
+NTC_Scalar SteinhartHartModel::resistanceToKelvins(const NTC_Scalar resistance) {
+  const NTC_Scalar l = NTC_LOG(resistance);
+  return 1 / (this->a + l * (this->b + this->c * l * l));
+}
+
+/*
+  3 points, closed form:
+  y = 1/K, g2 = (y2 - y1)/(L2 - L1), g3 = (y3 - y1)/(L3 - L1);
+  C = (g3 - g2) / (L1 + L2 + L3) / (L3 - L2);
+  B = g2 - C * (L1^2 + L1 * L2 + L2^2);
+  A = y1 - (B + L1^2 * C) * L1.
+
+  More points, least squares of y = A + B * L + C * L^3:
+  normal equations solved by Cramer's rule.
+*/
+SteinhartHartModel SteinhartHartModel::fit(
+  const double* resistances,
+  const double* celsius,
+  const int count
+) {
+  if (count == 3) {
+    const double l1 = log(resistances[0]);
+    const double l2 = log(resistances[1]);
+    const double l3 = log(resistances[2]);
+    const double y1 = 1.0 / (celsius[0] + 273.15);
+    const double y2 = 1.0 / (celsius[1] + 273.15);
+    const double y3 = 1.0 / (celsius[2] + 273.15);
+    const double g2 = (y2 - y1) / (l2 - l1);
+    const double g3 = (y3 - y1) / (l3 - l1);
+    const double c = (g3 - g2) / (l3 - l2) / (l1 + l2 + l3);
+    const double b = g2 - c * (l1 * l1 + l1 * l2 + l2 * l2);
+    return SteinhartHartModel(y1 - (b + l1 * l1 * c) * l1, b, c);
+  }
+  // sums of the normal equations
+  double s1 = 0, s2 = 0, s3 = 0, s4 = 0, s6 = 0;
+  double sy = 0, sly = 0, sl3y = 0;
+  for (int i = 0; i < count; ++i) {
+    const double l = log(resistances[i]);
+    const double l2 = l * l;
+    const double l3 = l2 * l;
+    const double y = 1.0 / (celsius[i] + 273.15);
+    s1 += l;
+    s2 += l2;
+    s3 += l3;
+    s4 += l3 * l;
+    s6 += l3 * l3;
+    sy += y;
+    sly += l * y;
+    sl3y += l3 * y;
+  }
+  const double n = count;
+  // | n  s1 s3 |   | A |   | sy   |
+  // | s1 s2 s4 | * | B | = | sly  |
+  // | s3 s4 s6 |   | C |   | sl3y |
+  const double det = n * (s2 * s6 - s4 * s4) - s1 * (s1 * s6 - s4 * s3) + s3 * (s1 * s4 - s2 * s3);
+  const double detA = sy * (s2 * s6 - s4 * s4) - s1 * (sly * s6 - s4 * sl3y) + s3 * (sly * s4 - s2 * sl3y);
+  const double detB = n * (sly * s6 - s4 * sl3y) - sy * (s1 * s6 - s4 * s3) + s3 * (s1 * sl3y - sly * s3);
+  const double detC = n * (s2 * sl3y - sly * s4) - s1 * (s1 * sl3y - sly * s3) + sy * (s1 * s4 - s2 * s3);
+  return SteinhartHartModel(detA / det, detB / det, detC / det);
+}
@@ -0,0 +1,77 @@
+/**
+  SteinhartHartModel - three coefficient
+  Steinhart-Hart equation of a thermistor:
+  1/K = A + B * ln(R) + C * ln(R)^3;
+  Evaluated in Horner form with one logarithm:
+  1/K = A + ln(R) * (B + C * ln(R)^2).
+
+  More accurate than the B-value equation over a wide
+  temperature range. The coefficients are given by the
+  datasheet or fitted to calibration points.
+
+  Instantiation, for example, to 10K thermistor:
+  ThermistorModel* model = new SteinhartHartModel(
+    1.009249522e-3, 2.378405444e-4, 2.019202697e-7
+  );
+
+  Or fitted to 3 or more calibration points:
+  const double RESISTANCES[] = { 27950, 9877, 1523 };
+  const double CELSIUS[] = { 0, 25, 80 };
+  SteinhartHartModel model = SteinhartHartModel::fit(RESISTANCES, CELSIUS, 3);
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef STEINHART_HART_MODEL_H
+#define STEINHART_HART_MODEL_H
+
+#include "ThermistorModel.h"
+
+class SteinhartHartModel final : public ThermistorModel {
+
+  private:
+    NTC_Scalar a;
+    NTC_Scalar b;
+    NTC_Scalar c;
+
+  public:
+    /**
+      Constructor
+
+      @param a - A coefficient
+      @param b - B coefficient
+      @param c - C coefficient
+    */
+    SteinhartHartModel(double a, double b, double c);
+
+    /**
+      Converts a resistance of the thermistor into a temperature.
+
+      @param resistance - resistance value to convert (> 0)
+      @return temperature in degree Kelvin
+    */
+    NTC_Scalar resistanceToKelvins(NTC_Scalar resistance) override;
+
+    /**
+      Fits the coefficients to calibration points:
+      exactly for 3 points, by least squares for more.
+      For more than 3 points, 64-bit double is recommended
+      (on AVR double is 32-bit).
+
+      @param resistances - resistances at the points (not NULL)
+      @param celsius - temperatures of the points in Celsius (not NULL)
+      @param count - number of points (>= 3)
+      @return fitted model
+    */
+    static SteinhartHartModel fit(
+      const double* resistances,
+      const double* celsius,
+      int count
+    );
+};
+
+#endif
@@ -9,6 +9,12 @@
 	v.2.0.3
 	- added virtual destructor
 
+	v.2.2.0
+	- added readCentiCelsius() method;
+	- added read() method and ThermistorReading structure;
+	- NTC_Scalar type of temperatures (see NTC_SINGLE_PRECISION);
+	- builds on a host without Arduino (see NTC_Host.h).
+
 	https://github.com/YuriiSalimov/NTC_Thermistor
 
 	Created by Yurii Salimov, May, 2019.
@@ -19,10 +25,56 @@
 
 #if defined(ARDUINO) && (ARDUINO >= 100)
 	#include <Arduino.h>
-#else
+#elif defined(ARDUINO)
 	#include <WProgram.h>
+#else
+	#include "NTC_Host.h"
 #endif
 
+/*
+	Floating-point type of temperatures and of the conversions.
+	double by default; the build flag -DNTC_SINGLE_PRECISION=1
+	makes it float, for FPUs of single precision only
+	(Cortex-M4F, ESP32), where double is emulated in software.
+	On AVR double is float anyway.
+*/
+#if defined(NTC_SINGLE_PRECISION) && NTC_SINGLE_PRECISION
+	typedef float NTC_Scalar;
+#else
+	typedef double NTC_Scalar;
+#endif
+
+/*
+	Temperature in hundredths of degree Celsius that is not
+	a reading (INT32_MIN): unknown or not read yet.
+	INT32_MIN itself needs __STDC_LIMIT_MACROS with avr-libc.
+*/
+#define NTC_NO_CENTI_CELSIUS ((int32_t) (-2147483647L - 1))
+
+/**
+	One reading of a thermistor in all units.
+	Celsius and Fahrenheit are derived from Kelvin.
+*/
+struct ThermistorReading {
+	NTC_Scalar analog;     // analog value, NAN if unknown.
+	NTC_Scalar resistance; // thermistor resistance, NAN if unknown.
+	NTC_Scalar kelvin;
+	NTC_Scalar celsius;
+	NTC_Scalar fahrenheit;
+
+	ThermistorReading(
+		const NTC_Scalar kelvin = 0,
+		const NTC_Scalar resistance = NAN,
+		const NTC_Scalar analog = NAN
+	) {
+		this->analog = analog;
+		this->resistance = resistance;
+		this->kelvin = kelvin;
+		this->celsius = kelvin - NTC_Scalar(273.15);
+		this->fahrenheit = this->celsius * NTC_Scalar(1.8) + 32;
+	}
+};
+
 class Thermistor {
 
 	public:
@@ -38,21 +90,52 @@ class Thermistor {
 
 			@return temperature in degree Celsius
 		*/
-		virtual double readCelsius() = 0;
+		virtual NTC_Scalar readCelsius() = 0;
 
 		/**
 			Reads a temperature in Kelvin from the thermistor.
 
 			@return temperature in degree Kelvin
 		*/
-		virtual double readKelvin() = 0;
+		virtual NTC_Scalar readKelvin() = 0;
 
 		/**
 			Reads a temperature in Fahrenheit from the thermistor.
 
 			@return temperature in degree Fahrenheit
 		*/
-		virtual double readFahrenheit() = 0;
+		virtual NTC_Scalar readFahrenheit() = 0;
+
+		/**
+			Reads a temperature in hundredths of degree Celsius
+			from the thermistor (2512 = 25.12 C).
+			By default, rounds the result of readCelsius(),
+			implementations may override it with an integer
+			path for boards without FPU.
+
+			@return temperature in hundredths of degree Celsius,
+			NTC_NO_CENTI_CELSIUS if the temperature is unknown (NAN)
+		*/
+		virtual int32_t readCentiCelsius() {
+			const NTC_Scalar celsius = readCelsius();
+			if (isnan(celsius)) {
+				return NTC_NO_CENTI_CELSIUS;
+			}
+			return (int32_t) (celsius * 100 + ((celsius < 0) ? NTC_Scalar(-0.5) : NTC_Scalar(0.5)));
+		}
+
+		/**
+			Reads a temperature from the thermistor once
+			and returns it in all units.
+			By default, converts the result of readKelvin(),
+			implementations may override it to add
+			the resistance and the analog value.
+
+			@return thermistor reading
+		*/
+		virtual ThermistorReading read() {
+			return ThermistorReading(readKelvin());
+		}
 };
 
 #endif
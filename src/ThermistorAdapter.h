@@ -0,0 +1,62 @@
+/**
+  ThermistorAdapter - adapts a thermistor composed by value
+  (StaticAverageThermistor, StaticSmoothThermistor, ...)
+  to the Thermistor interface. The adapted thermistor is kept
+  inside the adapter, so the adapter itself can be a global
+  or a local variable, without heap.
+
+  Instantiation:
+  ThermistorAdapter<
+    StaticSmoothThermistor<StaticAverageThermistor<NTC_Thermistor>, 5>
+  > adapter(A1, 8000, 100000, 25, 3950);
+  Thermistor* thermistor = &adapter;
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef THERMISTOR_ADAPTER_H
+#define THERMISTOR_ADAPTER_H
+
+#include "Thermistor.h"
+
+template <typename THERMISTOR>
+class ThermistorAdapter final : public Thermistor {
+
+  private:
+    THERMISTOR thermistor;
+
+  public:
+    /**
+      Constructor
+
+      @param args - constructor arguments of the adapted thermistor
+    */
+    template <typename... ARGS>
+    explicit ThermistorAdapter(ARGS... args) : thermistor(args...) {}
+
+    NTC_Scalar readCelsius() override {
+      return this->thermistor.readCelsius();
+    }
+
+    NTC_Scalar readKelvin() override {
+      return this->thermistor.readKelvin();
+    }
+
+    NTC_Scalar readFahrenheit() override {
+      return this->thermistor.readFahrenheit();
+    }
+
+    int32_t readCentiCelsius() override {
+      return this->thermistor.readCentiCelsius();
+    }
+
+    ThermistorReading read() override {
+      return this->thermistor.read();
+    }
+};
+
+#endif
@@ -0,0 +1,174 @@
+/**
+  ThermistorBank - class describes a set of NTC thermistors
+  on several analog ports, read in one pass.
+
+  The channels are kept as arrays (pins, coefficients,
+  last values) instead of one Thermistor instance per port:
+  no heap, no virtual calls, all analog ports are read first
+  and then converted in one loop into a caller's array.
+
+  Instantiation, for example, to 8 NTC 3950 thermistors:
+  ThermistorBank<8> bank;
+  bank.addChannel(A0, 8000, 100000, 25, 3950);
+  ...
+  bank.addChannel(A7, 8000, 100000, 25, 3950);
+
+  Read temperature:
+    NTC_Scalar celsius[8];
+    bank.readCelsius(celsius);
+    NTC_Scalar kelvin[8];
+    bank.readKelvin(kelvin);
+    NTC_Scalar fahrenheit[8];
+    bank.readFahrenheit(fahrenheit);
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef THERMISTOR_BANK_H
+#define THERMISTOR_BANK_H
+
+#include "Thermistor.h"
+#include "NTC_FastLog.h"
+
+template <int CHANNELS>
+class ThermistorBank final {
+
+  private:
+    // Default analog resolution for Arduino board
+    static const int DEFAULT_ADC_RESOLUTION = 1023;
+
+    static_assert(CHANNELS > 0, "CHANNELS must be positive");
+
+    int adcResolution;
+    int channelsNumber = 0;
+    int pins[CHANNELS];
+    // 1/K0 + ln(R0/Rn)/B, see readKelvin(*).
+    NTC_Scalar offsets[CHANNELS];
+    // 1/B
+    NTC_Scalar inverseBValues[CHANNELS];
+    int analogs[CHANNELS];
+
+  public:
+    /**
+      Constructor
+
+      @param adcResolution - ADC resolution of all channels
+      (default 1023, for Arduion)
+    */
+    explicit ThermistorBank(const int adcResolution = DEFAULT_ADC_RESOLUTION) {
+      this->adcResolution = max(adcResolution, 0);
+    }
+
+    /**
+      Adds a thermistor channel to the bank.
+
+      @param pin - an analog port number to be attached to the thermistor
+      @param referenceResistance - reference resistance
+      @param nominalResistance - nominal resistance at a nominal temperature
+      @param nominalTemperature - nominal temperature in Celsius
+      @param bValue - b-value of a thermistor
+      @return channel number, or -1 if the bank is full
+    */
+    int addChannel(
+      const int pin,
+      const double referenceResistance,
+      const double nominalResistance,
+      const double nominalTemperatureCelsius,
+      const double bValue
+    ) {
+      if (this->channelsNumber >= CHANNELS) {
+        return -1;
+      }
+      const int channel = this->channelsNumber++;
+      pinMode(this->pins[channel] = pin, INPUT);
+      this->offsets[channel] = 1.0 / (nominalTemperatureCelsius + 273.15) +
+        log(referenceResistance / nominalResistance) / bValue;
+      this->inverseBValues[channel] = 1.0 / bValue;
+      this->analogs[channel] = 0;
+      return channel;
+    }
+
+    /**
+      @return number of added channels
+    */
+    int size() {
+      return this->channelsNumber;
+    }
+
+    /**
+      Reads the analog ports of all channels, one after another,
+      and keeps the values for the conversion.
+    */
+    void scan() {
+      for (int i = 0; i < this->channelsNumber; ++i) {
+        this->analogs[i] = analogRead(this->pins[i]);
+      }
+    }
+
+    /**
+      Reads temperatures in Kelvin of all channels.
+      Resistance to Kelvin conversion of a channel:
+      1/K = 1/K0 + ln(R/Rn)/B, where R = R0 * V / (ADC - V),
+      1/K = (1/K0 + ln(R0/Rn)/B) + ln(V / (ADC - V))/B;
+      The first part is precomputed for every channel.
+
+      @param kelvins - array of size() temperatures to fill (not NULL)
+    */
+    void readKelvin(NTC_Scalar* kelvins) {
+      scan();
+      convertKelvin(kelvins);
+    }
+
+    /**
+      Reads temperatures in Celsius of all channels.
+
+      @param celsius - array of size() temperatures to fill (not NULL)
+    */
+    void readCelsius(NTC_Scalar* celsius) {
+      readKelvin(celsius);
+      for (int i = 0; i < this->channelsNumber; ++i) {
+        celsius[i] -= NTC_Scalar(273.15);
+      }
+    }
+
+    /**
+      Reads temperatures in Fahrenheit of all channels.
+
+      @param fahrenheit - array of size() temperatures to fill (not NULL)
+    */
+    void readFahrenheit(NTC_Scalar* fahrenheit) {
+      readCelsius(fahrenheit);
+      for (int i = 0; i < this->channelsNumber; ++i) {
+        fahrenheit[i] = fahrenheit[i] * NTC_Scalar(1.8) + 32;
+      }
+    }
+
+    /**
+      @param channel - channel number
+      @return the analog value of the channel of the last scan
+    */
+    int getAnalog(const int channel) {
+      return this->analogs[channel];
+    }
+
+  private:
+    /**
+      Converts the analog values of the last scan
+      into temperatures in Kelvin.
+
+      @param kelvins - array of size() temperatures to fill
+    */
+    inline void convertKelvin(NTC_Scalar* kelvins) {
+      for (int i = 0; i < this->channelsNumber; ++i) {
+        const NTC_Scalar analog = this->analogs[i];
+        kelvins[i] = 1 / (this->offsets[i] +
+          NTC_LOG(analog / (this->adcResolution - analog)) * this->inverseBValues[i]);
+      }
+    }
+};
+
+#endif
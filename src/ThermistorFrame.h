@@ -0,0 +1,86 @@
+/**
+  ThermistorFrame - binary frame format of ThermistorStream,
+  shared by the encoder on a board and the decoder on a host
+  (see extras/ThermistorStreamDecoder), depends on <stdint.h> only.
+
+  Frame, multi-byte values are little-endian:
+  0       SYNC (0xA5)
+  1       TYPE: RAW, CENTI_CELSIUS or DELTA
+  2       first channel number
+  3       COUNT - number of channels (1...MAX_COUNT)
+  4...5   time (ms), low 16 bits of millis()
+  6...    COUNT values of the channels, one by one:
+          RAW - uint16 analog values;
+          CENTI_CELSIUS - int16 temperatures in hundredths of degree Celsius
+          (-32767...32767), NO_CENTI_CELSIUS (-32768) - an unknown temperature;
+          DELTA - int8 differences to the previous temperatures
+          of the channels in hundredths of degree Celsius
+          (never to or from an unknown temperature).
+  last    CRC-8 (polynomial 0x07) of the bytes 1...last-1.
+
+  A frame of 1 channel takes 8 (DELTA) or 9 bytes,
+  a frame of 8 channels - 15 or 23 bytes.
+  The time wraps every 65.5 s, so a decoder restores it
+  from the previous frame, if frames come more often.
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef THERMISTOR_FRAME_H
+#define THERMISTOR_FRAME_H
+
+#include <stdint.h>
+
+struct ThermistorFrame final {
+
+  // First byte of a frame.
+  static const uint8_t SYNC = 0xA5;
+
+  // Types of frames.
+  static const uint8_t RAW = 0;
+  static const uint8_t CENTI_CELSIUS = 1;
+  static const uint8_t DELTA = 2;
+
+  // CENTI_CELSIUS value of an unknown temperature (a fault of the sensor).
+  static const int16_t NO_CENTI_CELSIUS = INT16_MIN;
+
+  // Bytes before the values.
+  static const int HEADER_SIZE = 6;
+  // Maximum number of channels of a frame.
+  static const int MAX_COUNT = 32;
+  // Maximum size of a frame (bytes).
+  static const int MAX_SIZE = HEADER_SIZE + 2 * MAX_COUNT + 1;
+
+  /**
+    @param type - type of a frame
+    @return size of a value of the type (bytes), 0 for an unknown type
+  */
+  static inline int valueSize(const uint8_t type) {
+    return (type == DELTA) ? 1 : ((type <= CENTI_CELSIUS) ? 2 : 0);
+  }
+
+  /**
+    CRC-8 with polynomial x^8 + x^2 + x + 1 (0x07), bit by bit,
+    no table in RAM.
+
+    @param data - bytes to calculate (not NULL)
+    @param length - number of bytes
+    @param crc - CRC of the previous bytes (default 0)
+    @return CRC of the bytes
+  */
+  static uint8_t crc8(const uint8_t* data, int length, uint8_t crc = 0) {
+    while (length-- > 0) {
+      crc ^= *data++;
+      for (int bit = 0; bit < 8; ++bit) {
+        crc = (crc & 0x80) ? (uint8_t) ((crc << 1) ^ 0x07) : (uint8_t) (crc << 1);
+      }
+    }
+    return crc;
+  }
+};
+
+#endif
@@ -0,0 +1,47 @@
+/**
+  ThermistorModel - interface describes a model
+  of a thermistor: conversion of its resistance
+  into a temperature.
+
+  Implementations:
+  BetaModel - B-value equation (as NTC_Thermistor by default);
+  SteinhartHartModel - three coefficient Steinhart-Hart equation;
+  PiecewiseModel - datasheet resistance/temperature points.
+
+  Instantiation, NTC_Thermistor with a model:
+  ThermistorModel* model = new SteinhartHartModel(A, B, C);
+  Thermistor* thermistor = new NTC_Thermistor(A1, 10000, model);
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef THERMISTOR_MODEL_H
+#define THERMISTOR_MODEL_H
+
+#include "Thermistor.h"
+#include "NTC_FastLog.h"
+
+class ThermistorModel {
+
+  public:
+
+    /**
+      Destructor
+      Deletes ThermistorModel instance.
+    */
+    virtual ~ThermistorModel() {};
+
+    /**
+      Converts a resistance of the thermistor into a temperature.
+
+      @param resistance - resistance value to convert (> 0)
+      @return temperature in degree Kelvin
+    */
+    virtual NTC_Scalar resistanceToKelvins(NTC_Scalar resistance) = 0;
+};
+
+#endif
@@ -0,0 +1,226 @@
+/**
+  ThermistorStream - encoder of temperatures and analog values
+  into compact binary frames (see ThermistorFrame) written
+  to Serial or any other Print, instead of formatted text.
+
+  A frame carries one or several channels (a thermistor,
+  a ThermistorBank...) with a channel number, a time
+  and a CRC. Temperatures are written as differences
+  to the previous ones (1 byte per channel), with a full
+  temperature (2 bytes) when the difference does not fit
+  or once per KEY_INTERVAL frames of the channel,
+  so a decoder started in the middle of a stream restores
+  the temperatures. After a corrupted or cut frame the decoder
+  drops the differences until the next full temperature
+  of the channel; a frame the output failed to write
+  is followed by full temperatures of its channels.
+  Only integer arithmetic, no formatting of floating point.
+
+  "Temperature: 25.07 C, 298.22 K, 77.13 F\r\n" takes 41 bytes,
+  the same reading in a frame - 8 or 9 bytes.
+
+  Instantiation:
+  ThermistorStream<CHANNELS> stream(Serial, KEY_INTERVAL);
+
+  Where,
+  CHANNELS - number of channels (default, 1).
+  KEY_INTERVAL - frames between full temperatures
+  of a channel (1...255, default 16).
+
+  Write readings:
+  stream.writeCentiCelsius(channel, thermistor->readCentiCelsius());
+  stream.writeCentiCelsius(firstChannel, centiCelsius, count);
+  stream.writeRaw(channel, analogRead(SENSOR_PIN));
+  stream.writeRaw(firstChannel, analogs, count);
+
+  Decoding on a host: extras/ThermistorStreamDecoder.
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef THERMISTOR_STREAM_H
+#define THERMISTOR_STREAM_H
+
+#include "Thermistor.h"
+#include "ThermistorFrame.h"
+
+template <int CHANNELS = 1>
+class ThermistorStream final {
+
+  private:
+    // Default frames between full temperatures of a channel.
+    static const int DEFAULT_KEY_INTERVAL = 16;
+
+    static_assert(CHANNELS > 0, "CHANNELS must be positive");
+    static_assert(CHANNELS <= 256, "CHANNELS must fit in a byte");
+
+    Print* output;
+    uint8_t keyInterval;
+    // Previous temperatures of the channels.
+    int16_t previous[CHANNELS];
+    // Frames of the channels until a full temperature, 0 - next frame.
+    uint8_t countdowns[CHANNELS] = {};
+    uint8_t frame[ThermistorFrame::MAX_SIZE];
+
+  public:
+    /**
+      Constructor
+
+      @param output - output of frames (Serial...)
+      @param keyInterval - frames between full temperatures
+      of a channel (1...255, default 16)
+    */
+    explicit ThermistorStream(Print& output, const int keyInterval = DEFAULT_KEY_INTERVAL) {
+      this->output = &output;
+      this->keyInterval = (uint8_t) constrain(keyInterval, 1, 255);
+    }
+
+    /**
+      Writes a frame of an analog value.
+
+      @param channel - channel number (0...CHANNELS-1)
+      @param analog - analog value
+      @return true if the frame is written
+    */
+    bool writeRaw(const int channel, const uint16_t analog) {
+      return writeRaw(channel, &analog, 1);
+    }
+
+    /**
+      Writes a frame of analog values of several channels.
+
+      @param firstChannel - channel number of the first value
+      @param analogs - analog values (not NULL)
+      @param count - number of values (1...ThermistorFrame::MAX_COUNT,
+      firstChannel + count <= CHANNELS)
+      @return true if the frame is written
+    */
+    bool writeRaw(const int firstChannel, const uint16_t* analogs, const int count) {
+      if (!isValid(firstChannel, count)) {
+        return false;
+      }
+      uint8_t* value = header(ThermistorFrame::RAW, firstChannel, count);
+      for (int i = 0; i < count; ++i) {
+        *value++ = (uint8_t) analogs[i];
+        *value++ = (uint8_t) (analogs[i] >> 8);
+      }
+      return send(value);
+    }
+
+    /**
+      Writes a frame of a temperature.
+
+      @param channel - channel number (0...CHANNELS-1)
+      @param centiCelsius - temperature in hundredths of degree Celsius
+      (limited to -327.67...327.67 C, NTC_NO_CENTI_CELSIUS if unknown)
+      @return true if the frame is written
+    */
+    bool writeCentiCelsius(const int channel, const int32_t centiCelsius) {
+      return writeCentiCelsius(channel, &centiCelsius, 1);
+    }
+
+    /**
+      Writes a frame of temperatures of several channels,
+      as differences, if all of them fit in a byte
+      and no channel needs a full temperature.
+
+      @param firstChannel - channel number of the first temperature
+      @param centiCelsius - temperatures in hundredths of degree Celsius (not NULL)
+      @param count - number of temperatures (1...ThermistorFrame::MAX_COUNT,
+      firstChannel + count <= CHANNELS)
+      @return true if the frame is written
+    */
+    bool writeCentiCelsius(const int firstChannel, const int32_t* centiCelsius, const int count) {
+      if (!isValid(firstChannel, count)) {
+        return false;
+      }
+      bool delta = true;
+      for (int i = 0; (i < count) && delta; ++i) {
+        const int channel = firstChannel + i;
+        const int16_t current = limit(centiCelsius[i]);
+        const int32_t difference = current - this->previous[channel];
+        delta = (this->countdowns[channel] > 0) && (difference >= -128) && (difference <= 127) &&
+          (current != ThermistorFrame::NO_CENTI_CELSIUS) &&
+          (this->previous[channel] != ThermistorFrame::NO_CENTI_CELSIUS);
+      }
+      uint8_t* value = header(
+        delta ? ThermistorFrame::DELTA : ThermistorFrame::CENTI_CELSIUS, firstChannel, count
+      );
+      for (int i = 0; i < count; ++i) {
+        const int channel = firstChannel + i;
+        const int16_t current = limit(centiCelsius[i]);
+        if (delta) {
+          *value++ = (uint8_t) (int8_t) (current - this->previous[channel]);
+          --this->countdowns[channel];
+        } else {
+          *value++ = (uint8_t) current;
+          *value++ = (uint8_t) ((uint16_t) current >> 8);
+          this->countdowns[channel] = this->keyInterval - 1;
+        }
+        this->previous[channel] = current;
+      }
+      if (send(value)) {
+        return true;
+      }
+      // The decoder has not got the temperatures.
+      for (int i = 0; i < count; ++i) {
+        this->countdowns[firstChannel + i] = 0;
+      }
+      return false;
+    }
+
+  private:
+    /**
+      @return true if the channels are of this stream
+      and fit in a frame
+    */
+    inline bool isValid(const int firstChannel, const int count) {
+      return (firstChannel >= 0) && (count > 0) &&
+        (count <= ThermistorFrame::MAX_COUNT) && (firstChannel + count <= CHANNELS);
+    }
+
+    /**
+      Limits a temperature to 16 bits,
+      an unknown temperature to ThermistorFrame::NO_CENTI_CELSIUS.
+    */
+    static inline int16_t limit(const int32_t centiCelsius) {
+      if (centiCelsius == NTC_NO_CENTI_CELSIUS) {
+        return ThermistorFrame::NO_CENTI_CELSIUS;
+      }
+      return (int16_t) constrain(centiCelsius, (int32_t) -32767, (int32_t) 32767);
+    }
+
+    /**
+      Fills the header of the frame.
+
+      @return position of the first value
+    */
+    uint8_t* header(const uint8_t type, const int firstChannel, const int count) {
+      const uint16_t time = (uint16_t) millis();
+      this->frame[0] = ThermistorFrame::SYNC;
+      this->frame[1] = type;
+      this->frame[2] = (uint8_t) firstChannel;
+      this->frame[3] = (uint8_t) count;
+      this->frame[4] = (uint8_t) time;
+      this->frame[5] = (uint8_t) (time >> 8);
+      return this->frame + ThermistorFrame::HEADER_SIZE;
+    }
+
+    /**
+      Adds the CRC and writes the frame in one call.
+
+      @param end - position after the last value
+      @return true if the frame is written
+    */
+    bool send(uint8_t* end) {
+      const int length = (int) (end - this->frame);
+      *end = ThermistorFrame::crc8(this->frame + 1, length - 1);
+      return this->output->write(this->frame, length + 1) == (size_t) (length + 1);
+    }
+};
+
+#endif
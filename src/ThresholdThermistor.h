@@ -0,0 +1,206 @@
+/**
+  ThresholdThermistor - NTC thermistor that reports
+  when a temperature crosses thresholds, instead of polling
+  readCelsius() and comparing temperatures.
+
+  Thresholds in Celsius are converted into analog values once,
+  in addThreshold(), by the same conversion as readCelsius()
+  (B-value equation or the model, NTC_FAST_LOG, NTC_SINGLE_PRECISION).
+  update() reads one analog value and compares integers only:
+  no log(), no floating point, no conversion at all until
+  the application asks for a temperature.
+
+  N thresholds split the temperature into N + 1 bands,
+  band 0 is below the lowest threshold, band N is above
+  the highest one. A threshold is crossed upwards at its
+  temperature and downwards at its temperature minus
+  the hysteresis, so the noise at a threshold fires no events.
+
+  Instantiation:
+  ThresholdThermistor<THRESHOLDS>* thermistor = new ThresholdThermistor<THRESHOLDS>(
+    SENSOR_PIN, 8000, 100000, 25, 3950
+  );
+  Constructors are the same as of NTC_Thermistor (AdcSource, models...).
+  thermistor->addThreshold(50, 2); // 50 C, released below 48 C
+  thermistor->addThreshold(80, 2);
+  thermistor->onBandChange(callback);
+
+  Where,
+  THRESHOLDS - maximum number of thresholds (default, 4).
+
+  loop() (or a timer):
+  thermistor->update(); // calls back when the band is changed
+
+  Callback:
+  void callback(int band, int previousBand) {
+    // band entered, previousBand left (-1 on the first update())
+  }
+
+  v.2.2.0
+  - created
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef THRESHOLD_THERMISTOR_H
+#define THRESHOLD_THERMISTOR_H
+
+#include "NTC_Thermistor.h"
+
+template <int THRESHOLDS = 4>
+class ThresholdThermistor final : public NTC_Thermistor {
+
+  public:
+    /**
+      Called when the band is changed.
+
+      @param band - band entered (0...number of thresholds)
+      @param previousBand - band left (-1 before the first update())
+    */
+    typedef void (*BandCallback)(int band, int previousBand);
+
+  private:
+    static_assert(THRESHOLDS > 0, "THRESHOLDS must be positive");
+
+    int thresholdsNumber = 0;
+    // Largest analog values at or above a threshold temperature,
+    // the analog value falls while the temperature rises.
+    int enterAnalogs[THRESHOLDS];
+    // Largest analog values at or above a threshold minus the hysteresis.
+    int leaveAnalogs[THRESHOLDS];
+    int band = -1;
+    int analog = 0;
+    BandCallback callback = NULL;
+
+  public:
+    using NTC_Thermistor::NTC_Thermistor;
+
+    /**
+      Adds a threshold, converts it into analog values.
+      Thresholds may be added in any order, bands are numbered
+      by temperature; resets the band, so the next update()
+      calls back with the previous band of -1.
+
+      @param celsius - threshold temperature in Celsius
+      @param hysteresisCelsius - the threshold is crossed downwards
+      at celsius - hysteresisCelsius (>= 0, default 0)
+      @return true if the threshold is added, false if there are THRESHOLDS
+    */
+    bool addThreshold(const double celsius, const double hysteresisCelsius = 0) {
+      if (this->thresholdsNumber >= THRESHOLDS) {
+        return false;
+      }
+      const int enterAnalog = celsiusToAnalog(celsius);
+      const int leaveAnalog = celsiusToAnalog(celsius - max(hysteresisCelsius, 0.0));
+      // Insertion by temperature: higher temperature, lower analog value.
+      int position = this->thresholdsNumber++;
+      while (position > 0 && this->enterAnalogs[position - 1] < enterAnalog) {
+        this->enterAnalogs[position] = this->enterAnalogs[position - 1];
+        this->leaveAnalogs[position] = this->leaveAnalogs[position - 1];
+        --position;
+      }
+      this->enterAnalogs[position] = enterAnalog;
+      this->leaveAnalogs[position] = leaveAnalog;
+      this->band = -1;
+      return true;
+    }
+
+    /**
+      Sets the function called when the band is changed.
+
+      @param callback - function to call (NULL, to call nothing)
+    */
+    void onBandChange(const BandCallback callback) {
+      this->callback = callback;
+    }
+
+    /**
+      Reads one analog value and finds its band
+      by integer comparisons with the hysteresis,
+      calls back if the band is changed.
+
+      @return true if the band is changed
+    */
+    bool update() {
+      const int value = readAnalog();
+      this->analog = value;
+      int newBand = 0;
+      if (this->band < 0) {
+        // No previous band: the thresholds themselves.
+        while (newBand < this->thresholdsNumber && value <= this->enterAnalogs[newBand]) {
+          ++newBand;
+        }
+      } else {
+        // Up from the previous band while the next thresholds are entered,
+        // down while the crossed ones are left.
+        newBand = this->band;
+        while (newBand < this->thresholdsNumber && value <= this->enterAnalogs[newBand]) {
+          ++newBand;
+        }
+        while (newBand > 0 && value > this->leaveAnalogs[newBand - 1]) {
+          --newBand;
+        }
+      }
+      if (newBand == this->band) {
+        return false;
+      }
+      const int previousBand = this->band;
+      this->band = newBand;
+      if (this->callback != NULL) {
+        this->callback(newBand, previousBand);
+      }
+      return true;
+    }
+
+    /**
+      @return band of the latest update() (-1 before the first one)
+    */
+    inline int getBand() const {
+      return this->band;
+    }
+
+    /**
+      @return analog value of the latest update()
+    */
+    inline int getAnalog() const {
+      return this->analog;
+    }
+
+    /**
+      Converts the analog value of the latest update(),
+      does not read the analog port.
+
+      @return temperature in degree Celsius
+    */
+    NTC_Scalar getCelsius() {
+      return analogToKelvins(this->analog) - NTC_Scalar(273.15);
+    }
+
+  private:
+    /**
+      Finds the largest analog value at or above the temperature
+      by bisection of the conversion, 1...ADC-1
+      (0 if even 1 is below, ADC if even ADC-1 is above).
+
+      @param celsius - temperature in Celsius
+      @return analog value
+    */
+    int celsiusToAnalog(const double celsius) {
+      const NTC_Scalar kelvin = (NTC_Scalar) (celsius + 273.15);
+      // kelvin(low) >= kelvin, kelvin(high) < kelvin.
+      int low = 0;
+      int high = this->adcResolution;
+      while (high - low > 1) {
+        const int middle = low + (high - low) / 2;
+        if (analogToKelvins(middle) >= kelvin) {
+          low = middle;
+        } else {
+          high = middle;
+        }
+      }
+      return low;
+    }
+};
+
+#endif
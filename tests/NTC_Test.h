@@ -0,0 +1,121 @@
+/**
+  NTC_Test - minimal unit tests of the library on a host
+  (see NTC_Host.h), without dependencies.
+
+  TEST(name) {
+    CHECK(condition);
+    CHECK_EQUAL(expected, actual);
+    CHECK_NEAR(expected, actual, tolerance);
+  }
+
+  int main() {
+    return NTC_Test::run();
+  }
+
+  https://github.com/YuriiSalimov/NTC_Thermistor
+
+  Released into the public domain.
+*/
+#ifndef NTC_TEST_H
+#define NTC_TEST_H
+
+#include <math.h>
+#include <stdio.h>
+
+class NTC_Test final {
+
+  public:
+    typedef void (*Function)();
+
+    // Registers a test, see TEST().
+    NTC_Test(const char* name, const Function function) {
+      this->name = name;
+      this->function = function;
+      this->next = head();
+      head() = this;
+    }
+
+    static void fail(const char* file, const int line, const char* message) {
+      printf("%s:%d: %s\n", file, line, message);
+      ++failures();
+    }
+
+    static bool near(const double expected, const double actual, const double tolerance) {
+      return fabs(expected - actual) <= tolerance;
+    }
+
+    /**
+      Runs the tests in order of declaration.
+
+      @return 0 if all tests pass, 1 otherwise
+    */
+    static int run() {
+      NTC_Test* tests = NULL;
+      // Reverses the registration order.
+      while (head() != NULL) {
+        NTC_Test* test = head();
+        head() = test->next;
+        test->next = tests;
+        tests = test;
+      }
+      int count = 0;
+      int failed = 0;
+      for (NTC_Test* test = tests; test != NULL; test = test->next, ++count) {
+        const int before = failures();
+        test->function();
+        if (failures() != before) {
+          printf("FAILED %s\n", test->name);
+          ++failed;
+        }
+      }
+      printf("%d tests, %d failed\n", count, failed);
+      return (failed == 0) ? 0 : 1;
+    }
+
+  private:
+    const char* name;
+    Function function;
+    NTC_Test* next;
+
+    static NTC_Test*& head() {
+      static NTC_Test* tests = NULL;
+      return tests;
+    }
+
+    static int& failures() {
+      static int count = 0;
+      return count;
+    }
+};
+
+#define TEST(name) \
+  static void name(); \
+  static NTC_Test name##_test(#name, name); \
+  static void name()
+
+#define CHECK(condition) \
+  do { \
+    if (!(condition)) NTC_Test::fail(__FILE__, __LINE__, "CHECK(" #condition ")"); \
+  } while (0)
+
+#define CHECK_EQUAL(expected, actual) \
+  do { \
+    const double e_ = (double) (expected); \
+    const double a_ = (double) (actual); \
+    if (e_ != a_) { \
+      printf("  expected %.6f, actual %.6f\n", e_, a_); \
+      NTC_Test::fail(__FILE__, __LINE__, "CHECK_EQUAL(" #expected ", " #actual ")"); \
+    } \
+  } while (0)
+
+#define CHECK_NEAR(expected, actual, tolerance) \
+  do { \
+    const double e_ = (double) (expected); \
+    const double a_ = (double) (actual); \
+    if (!NTC_Test::near(e_, a_, (tolerance))) { \
+      printf("  expected %.6f, actual %.6f\n", e_, a_); \
+      NTC_Test::fail(__FILE__, __LINE__, "CHECK_NEAR(" #expected ", " #actual ", " #tolerance ")"); \
+    } \
+  } while (0)
+
+#endif
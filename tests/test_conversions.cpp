@@ -0,0 +1,289 @@
+/**
+  Conversions of analog values into temperatures:
+  the B-value equation, models, fixed point, lookup tables.
+*/
+#include "NTC_Test.h"
+#include <NTC_Thermistor.h>
+#include <NTC_TableThermistor.h>
+#include <NTC_FixedThermistor.h>
+#include <FakeAdcSource.h>
+#include <BetaModel.h>
+#include <SteinhartHartModel.h>
+#include <PiecewiseModel.h>
+#include <ThermistorBank.h>
+
+#define REFERENCE_RESISTANCE 8000
+#define NOMINAL_RESISTANCE 100000
+#define NOMINAL_TEMPERATURE 25
+#define B_VALUE 3950
+
+// Conversions of NTC_Scalar: float with NTC_SINGLE_PRECISION.
+static const double TOLERANCE = 0.01;
+
+// The B-value equation in double precision.
+static double referenceResistance(const double analog, const double adcResolution = 1023) {
+  return REFERENCE_RESISTANCE / (adcResolution / analog - 1);
+}
+
+static double referenceCelsius(const double analog, const double adcResolution = 1023) {
+  const double resistance = referenceResistance(analog, adcResolution);
+  return 1 / (1 / (NOMINAL_TEMPERATURE + 273.15) +
+    log(resistance / NOMINAL_RESISTANCE) / B_VALUE) - 273.15;
+}
+
+TEST(b_value_equation) {
+  const int VALUES[] = { 100, 500, 947, 1000 };
+  FakeAdcSource source(VALUES, 4);
+  NTC_Thermistor thermistor(&source, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE);
+  for (int i = 0; i < 4; ++i) {
+    CHECK_NEAR(referenceCelsius(VALUES[i]), thermistor.readCelsius(), TOLERANCE);
+  }
+}
+
+TEST(nominal_temperature) {
+  // R = Rn: 8000 / (1023 / V - 1) = 100000.
+  const int VALUES[] = { 947 };
+  NTC_Host::setAnalogValues(A1, VALUES, 1);
+  NTC_Thermistor thermistor(A1, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE);
+  CHECK_NEAR(referenceCelsius(947), thermistor.readCelsius(), TOLERANCE);
+  CHECK_NEAR(25, thermistor.readCelsius(), 0.3);
+}
+
+TEST(units) {
+  const int VALUES[] = { 600 };
+  FakeAdcSource source(VALUES, 1);
+  NTC_Thermistor thermistor(&source, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE);
+  const double celsius = referenceCelsius(600);
+  CHECK_NEAR(celsius + 273.15, thermistor.readKelvin(), TOLERANCE);
+  CHECK_NEAR(celsius * 1.8 + 32, thermistor.readFahrenheit(), 2 * TOLERANCE);
+  const ThermistorReading reading = thermistor.read();
+  CHECK_EQUAL(600, reading.analog);
+  CHECK_NEAR(referenceResistance(600), reading.resistance, 0.01);
+  CHECK_NEAR(celsius, reading.celsius, TOLERANCE);
+  CHECK_NEAR(celsius + 273.15, reading.kelvin, TOLERANCE);
+  CHECK_NEAR(celsius * 1.8 + 32, reading.fahrenheit, 2 * TOLERANCE);
+  CHECK_EQUAL(3, source.getReadingsCount());
+}
+
+TEST(fixed_point) {
+  // -40 C...150 C.
+  for (int analog = 100; analog <= 1003; analog += 7) {
+    NTC_Host::setAnalogValues(A2, &analog, 1);
+    NTC_Thermistor thermistor(A2, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE);
+    CHECK_NEAR(referenceCelsius(analog) * 100, thermistor.readCentiCelsius(), 3);
+  }
+}
+
+/**
+  Thermistor with a voltage that has a fraction,
+  as NTC_Thermistor_ESP32.
+*/
+class VoltageThermistor final : public NTC_Thermistor {
+
+  public:
+    NTC_Scalar voltage = 0;
+
+    VoltageThermistor() : NTC_Thermistor(A7, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE) {}
+
+  protected:
+    NTC_Scalar readVoltage() override {
+      return this->voltage;
+    }
+
+    int readAnalog() override {
+      return 0;
+    }
+};
+
+TEST(centi_celsius_of_voltage) {
+  VoltageThermistor thermistor;
+  // The fraction is not dropped.
+  thermistor.voltage = NTC_Scalar(600.5);
+  CHECK_NEAR(referenceCelsius(600.5) * 100, thermistor.readCentiCelsius(), 1);
+  // Integers are converted in fixed point.
+  thermistor.voltage = 600;
+  CHECK_NEAR(referenceCelsius(600) * 100, thermistor.readCentiCelsius(), 3);
+}
+
+TEST(beta_model) {
+  const int VALUES[] = { 300, 947 };
+  FakeAdcSource source(VALUES, 2);
+  BetaModel model(NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE);
+  NTC_Thermistor thermistor(&source, REFERENCE_RESISTANCE, &model);
+  CHECK_NEAR(referenceCelsius(300), thermistor.readCelsius(), TOLERANCE);
+  CHECK_NEAR(referenceCelsius(947), thermistor.readCelsius(), TOLERANCE);
+  // Rounds readCelsius() with a model.
+  CHECK_NEAR(referenceCelsius(300) * 100, thermistor.readCentiCelsius(), 1);
+}
+
+TEST(beta_model_fit) {
+  const double r1 = referenceResistance(300);
+  const double r2 = referenceResistance(900);
+  BetaModel model = BetaModel::fit(r1, referenceCelsius(300), r2, referenceCelsius(900));
+  CHECK_NEAR(referenceCelsius(600) + 273.15, model.resistanceToKelvins(referenceResistance(600)), TOLERANCE);
+}
+
+TEST(steinhart_hart_model) {
+  const double RESISTANCES[] = { 332094, 100000, 6530 };
+  const double CELSIUS[] = { 0, 25, 85 };
+  SteinhartHartModel model = SteinhartHartModel::fit(RESISTANCES, CELSIUS, 3);
+  for (int i = 0; i < 3; ++i) {
+    CHECK_NEAR(CELSIUS[i] + 273.15, model.resistanceToKelvins(RESISTANCES[i]), TOLERANCE);
+  }
+}
+
+TEST(piecewise_model) {
+  const double CELSIUS[] = { 0, 25, 85 };
+  const double RESISTANCES[] = { 332094, 100000, 6530 };
+  PiecewiseModel model(RESISTANCES, CELSIUS, 3);
+  for (int i = 0; i < 3; ++i) {
+    CHECK_NEAR(CELSIUS[i] + 273.15, model.resistanceToKelvins(RESISTANCES[i]), TOLERANCE);
+  }
+  // Between the points.
+  const double kelvin = model.resistanceToKelvins(50000);
+  CHECK((kelvin > 25 + 273.15) && (kelvin < 85 + 273.15));
+}
+
+TEST(piecewise_model_without_segments) {
+  const double CELSIUS[] = { 25 };
+  const double RESISTANCES[] = { 100000 };
+  PiecewiseModel one(RESISTANCES, CELSIUS, 1);
+  CHECK(isnan(one.resistanceToKelvins(100000)));
+  PiecewiseModel none(RESISTANCES, CELSIUS, 0);
+  CHECK(isnan(none.resistanceToKelvins(100000)));
+  PiecewiseModel negative(RESISTANCES, CELSIUS, -1);
+  CHECK(isnan(negative.resistanceToKelvins(100000)));
+}
+
+TEST(ram_table) {
+  // 1024 entries: 0.19 C apart.
+  const int VALUES[] = { 250, 500, 947, 1015 };
+  FakeAdcSource source(VALUES, 4);
+  NTC_TableThermistor thermistor(&source, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE, 1024);
+  for (int i = 0; i < 4; ++i) {
+    CHECK_NEAR(referenceCelsius(VALUES[i]), thermistor.readCelsius(), TOLERANCE);
+  }
+}
+
+// The equation within the range of a table, its ends out of the range.
+static double tableCelsius(const int analog, const double lowest, const double highest) {
+  const double celsius = referenceCelsius(analog);
+  return (celsius < lowest) ? lowest : ((celsius > highest) ? highest : celsius);
+}
+
+TEST(interpolated_table) {
+  // 33 entries, -40 C...150 C: the whole analog range.
+  NTC_TableThermistor thermistor(A3, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE, 33);
+  for (int analog = 1; analog <= 1022; ++analog) {
+    NTC_Host::setAnalogValues(A3, &analog, 1);
+    CHECK_NEAR(tableCelsius(analog, -40, 150), thermistor.readCelsius(), 0.3);
+    CHECK_NEAR(thermistor.readCelsius() * 100, thermistor.readCentiCelsius(), 0.5);
+  }
+}
+
+TEST(table_range) {
+  // 65 entries, 0 C...300 C.
+  NTC_TableThermistor thermistor(A3, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE, 65, 1023, 0, 300);
+  for (int analog = 1; analog <= 1022; ++analog) {
+    NTC_Host::setAnalogValues(A3, &analog, 1);
+    CHECK_NEAR(tableCelsius(analog, 0, 300), thermistor.readCelsius(), 0.3);
+  }
+}
+
+TEST(model_table) {
+  // Steinhart-Hart model through the table, the same as the model.
+  const double RESISTANCES[] = { 332094, 100000, 6530 };
+  const double CELSIUS[] = { 0, 25, 85 };
+  SteinhartHartModel model = SteinhartHartModel::fit(RESISTANCES, CELSIUS, 3);
+  NTC_TableThermistor table(A3, REFERENCE_RESISTANCE, &model, 33, 1023, -20, 120);
+  NTC_Thermistor equation(A3, REFERENCE_RESISTANCE, &model);
+  for (int analog = 300; analog <= 1010; analog += 10) {
+    NTC_Host::setAnalogValues(A3, &analog, 1);
+    CHECK_NEAR(equation.readCelsius(), table.readCelsius(), 0.3);
+  }
+}
+
+TEST(fixed_table) {
+  // The equation on both sides of 25 C (analog 947), the same as the RAM table.
+  NTC_FixedThermistor<REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE> fixed(A4);
+  NTC_TableThermistor table(A4, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE, 33);
+  NTC_Thermistor equation(A4, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE);
+  for (int analog = 210; analog <= 1020; analog += 5) {
+    NTC_Host::setAnalogValues(A4, &analog, 1);
+    CHECK_NEAR(equation.readCelsius(), fixed.readCelsius(), 0.3);
+    CHECK_NEAR(table.readCelsius(), fixed.readCelsius(), TOLERANCE);
+  }
+  const int COLD[] = { 1010 };
+  NTC_Host::setAnalogValues(A4, COLD, 1);
+  CHECK_NEAR(referenceCelsius(1010), fixed.readCelsius(), 0.3);
+  CHECK(fixed.readCelsius() < -10);
+
+  // 65 entries, 0 C...300 C.
+  NTC_FixedThermistor<REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE, 1023, 65, 0, 300> hot(A4);
+  const int HOT[] = { 60 };
+  NTC_Host::setAnalogValues(A4, HOT, 1);
+  CHECK_NEAR(referenceCelsius(60), hot.readCelsius(), 0.3);
+}
+
+TEST(fixed_table_parameters) {
+  const int VALUES[] = { 600 };
+  NTC_Host::setAnalogValues(A4, VALUES, 1);
+  NTC_FixedThermistor<REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE> fixed(A4);
+  const ThermistorReading reading = fixed.read();
+  CHECK_NEAR(referenceResistance(600), reading.resistance, 0.01);
+  CHECK_NEAR(referenceResistance(600), fixed.readSample().getResistance(), 0.01);
+}
+
+TEST(batch_conversion) {
+  const uint16_t ANALOGS[] = { 100, 300, 500, 700, 947 };
+  float kelvins[5];
+  const int VALUES[] = { 0 };
+  FakeAdcSource source(VALUES, 1);
+  NTC_Thermistor thermistor(&source, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE);
+  thermistor.analogsToKelvins(ANALOGS, kelvins, 5);
+  for (int i = 0; i < 5; ++i) {
+    CHECK_NEAR(referenceCelsius(ANALOGS[i]) + 273.15, kelvins[i], TOLERANCE);
+  }
+  // Does not read the source.
+  CHECK_EQUAL(0, source.getReadingsCount());
+}
+
+TEST(table_batch_conversion) {
+  // Through the table, also without the thermistor parameters.
+  static const float TABLE[] PROGMEM = { 520, 400, 350, 320, 300, 280, 250 };
+  const uint16_t ANALOGS[] = { 0, 100, 512, 950, 1023 };
+  float kelvins[5];
+  const int VALUES[] = { 0 };
+  NTC_Host::setAnalogValues(A5, VALUES, 1);
+  NTC_TableThermistor flash(A5, TABLE, 7);
+  NTC_TableThermistor ram(A5, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE, 33);
+  NTC_TableThermistor* thermistors[] = { &flash, &ram };
+  for (int t = 0; t < 2; ++t) {
+    NTC_Thermistor* thermistor = thermistors[t];
+    thermistor->analogsToKelvins(ANALOGS, kelvins, 5);
+    for (int i = 0; i < 5; ++i) {
+      int analog = constrain((int) ANALOGS[i], 1, 1022);
+      NTC_Host::setAnalogValues(A5, &analog, 1);
+      CHECK_NEAR(thermistor->readKelvin(), kelvins[i], 1e-3);
+    }
+  }
+}
+
+TEST(bank) {
+  const int VALUES_1[] = { 400 };
+  const int VALUES_2[] = { 800 };
+  NTC_Host::setAnalogValues(A5, VALUES_1, 1);
+  NTC_Host::setAnalogValues(A6, VALUES_2, 1);
+  ThermistorBank<2> bank;
+  CHECK_EQUAL(0, bank.addChannel(A5, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE));
+  CHECK_EQUAL(1, bank.addChannel(A6, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE));
+  CHECK_EQUAL(-1, bank.addChannel(A7, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE));
+  NTC_Scalar celsius[2];
+  bank.readCelsius(celsius);
+  CHECK_NEAR(referenceCelsius(400), celsius[0], TOLERANCE);
+  CHECK_NEAR(referenceCelsius(800), celsius[1], TOLERANCE);
+}
+
+int main() {
+  return NTC_Test::run();
+}
@@ -0,0 +1,355 @@
+/**
+  Decorators of thermistors and of analog sources:
+  averaging, smoothing, filtering, power and background sampling.
+*/
+#include "NTC_Test.h"
+#include <NTC_Thermistor.h>
+#include <AverageThermistor.h>
+#include <SmoothThermistor.h>
+#include <MovingAverageThermistor.h>
+#include <MedianThermistor.h>
+#include <StaticAverageThermistor.h>
+#include <StaticSmoothThermistor.h>
+#include <ThermistorAdapter.h>
+#include <DutyCycledThermistor.h>
+#include <ThresholdThermistor.h>
+#include <BackgroundThermistor.h>
+#include <FakeAdcSource.h>
+#include <DmaAdcSource.h>
+#include <SmoothAdcSource.h>
+#include <OversamplingAdcSource.h>
+#include <RatiometricAdcSource.h>
+
+#define REFERENCE_RESISTANCE 8000
+#define NOMINAL_RESISTANCE 100000
+#define NOMINAL_TEMPERATURE 25
+#define B_VALUE 3950
+
+static const double TOLERANCE = 0.01;
+
+/**
+  Thermistor returning scripted temperatures in Kelvin,
+  one by one, starting over after the last one.
+*/
+class ScriptedThermistor final : public Thermistor {
+
+  private:
+    const double* kelvins;
+    int length;
+    int position = 0;
+
+  public:
+    ScriptedThermistor(const double* kelvins, const int length) {
+      this->kelvins = kelvins;
+      this->length = length;
+    }
+
+    NTC_Scalar readCelsius() override {
+      return readKelvin() - NTC_Scalar(273.15);
+    }
+
+    NTC_Scalar readKelvin() override {
+      const double kelvin = this->kelvins[this->position];
+      this->position = (this->position + 1) % this->length;
+      return (NTC_Scalar) kelvin;
+    }
+
+    NTC_Scalar readFahrenheit() override {
+      return readCelsius() * NTC_Scalar(1.8) + 32;
+    }
+};
+
+static double referenceCelsius(const double analog) {
+  const double resistance = REFERENCE_RESISTANCE / (1023 / analog - 1);
+  return 1 / (1 / (NOMINAL_TEMPERATURE + 273.15) +
+    log(resistance / NOMINAL_RESISTANCE) / B_VALUE) - 273.15;
+}
+
+// Analog value nearest to the temperature.
+static int referenceAnalog(const double celsius) {
+  int nearest = 1;
+  for (int analog = 1; analog < 1023; ++analog) {
+    if (fabs(referenceCelsius(analog) - celsius) < fabs(referenceCelsius(nearest) - celsius)) {
+      nearest = analog;
+    }
+  }
+  return nearest;
+}
+
+TEST(average) {
+  const double KELVINS[] = { 300, 301, 302, 303 };
+  AverageThermistor thermistor(new ScriptedThermistor(KELVINS, 4), 4, 0);
+  CHECK_NEAR(301.5, thermistor.readKelvin(), TOLERANCE);
+  CHECK_NEAR(301.5 - 273.15, thermistor.readCelsius(), TOLERANCE);
+  CHECK_NEAR(301.5 - 273.15, thermistor.read().celsius, TOLERANCE);
+}
+
+TEST(average_update) {
+  const double KELVINS[] = { 300, 302 };
+  AverageThermistor thermistor(new ScriptedThermistor(KELVINS, 2), 2, 0);
+  CHECK(!thermistor.isReady());
+  CHECK(!thermistor.update());
+  delay(1);
+  CHECK(thermistor.update());
+  CHECK(thermistor.isReady());
+  CHECK_NEAR(301, thermistor.getKelvin(), TOLERANCE);
+}
+
+TEST(average_centi_celsius) {
+  // Means of 0.01 C and 0.02 C, of -0.01 C and -0.02 C are rounded.
+  const double KELVINS[] = { 273.16, 273.17 };
+  AverageThermistor thermistor(new ScriptedThermistor(KELVINS, 2), 2, 0);
+  CHECK_EQUAL(2, thermistor.readCentiCelsius());
+  const double NEGATIVE_KELVINS[] = { 273.14, 273.13 };
+  AverageThermistor negative(new ScriptedThermistor(NEGATIVE_KELVINS, 2), 2, 0);
+  CHECK_EQUAL(-2, negative.readCentiCelsius());
+
+  StaticAverageThermistor<ScriptedThermistor, 2, 0> staticThermistor(KELVINS, 2);
+  CHECK_EQUAL(2, staticThermistor.readCentiCelsius());
+  StaticAverageThermistor<ScriptedThermistor, 2, 0> staticNegative(NEGATIVE_KELVINS, 2);
+  CHECK_EQUAL(-2, staticNegative.readCentiCelsius());
+}
+
+TEST(smooth) {
+  const double KELVINS[] = { 300, 310 };
+  SmoothThermistor thermistor(new ScriptedThermistor(KELVINS, 2), 2);
+  // The first reading starts the smoothing as is.
+  CHECK_NEAR(300, thermistor.readKelvin(), TOLERANCE);
+  CHECK_NEAR(305, thermistor.readKelvin(), TOLERANCE);
+  CHECK_NEAR(302.5, thermistor.readKelvin(), TOLERANCE);
+}
+
+TEST(smooth_units) {
+  const double KELVINS[] = { 300, 310, 320 };
+  SmoothThermistor thermistor(new ScriptedThermistor(KELVINS, 3), 2);
+  // One smoothing for all units, one step per reading.
+  CHECK_NEAR(300, thermistor.readKelvin(), TOLERANCE);
+  CHECK_NEAR(305 - 273.15, thermistor.readCelsius(), TOLERANCE);
+  CHECK_NEAR(312.5, thermistor.read().kelvin, TOLERANCE);
+  CHECK_NEAR((306.25 - 273.15) * 1.8 + 32, thermistor.readFahrenheit(), 2 * TOLERANCE);
+}
+
+TEST(moving_average) {
+  const double KELVINS[] = { 300, 303, 306, 309, 312 };
+  MovingAverageThermistor<3> thermistor(new ScriptedThermistor(KELVINS, 5));
+  CHECK_NEAR(300, thermistor.readKelvin(), TOLERANCE);
+  CHECK_NEAR(301.5, thermistor.readKelvin(), TOLERANCE);
+  CHECK_NEAR(303, thermistor.readKelvin(), TOLERANCE);
+  // The window slides: 303, 306, 309.
+  CHECK_NEAR(306, thermistor.readKelvin(), TOLERANCE);
+  CHECK_NEAR(309, thermistor.readKelvin(), TOLERANCE);
+}
+
+TEST(moving_average_drift) {
+  // A long run of readings in single precision: the mean stays exact.
+  static double kelvins[997];
+  for (int i = 0; i < 997; ++i) {
+    kelvins[i] = 298.15 + 0.37 * sin(i * 0.1) + ((i * 7919) % 13) * 0.0123;
+  }
+  MovingAverageThermistor<16> thermistor(new ScriptedThermistor(kelvins, 997));
+  NTC_Scalar mean = 0;
+  const long READINGS = 200000;
+  for (long i = 0; i < READINGS; ++i) {
+    mean = thermistor.readKelvin();
+  }
+  double expected = 0;
+  for (long i = READINGS - 16; i < READINGS; ++i) {
+    expected += (NTC_Scalar) kelvins[i % 997];
+  }
+  CHECK_NEAR(expected / 16, mean, 1e-4);
+}
+
+TEST(median_rejects_spike) {
+  const double KELVINS[] = { 300, 300.2, 400, 299.8, 300.1 };
+  MedianThermistor<5> thermistor(new ScriptedThermistor(KELVINS, 5));
+  const double kelvin = thermistor.readKelvin();
+  CHECK((kelvin > 299.7) && (kelvin < 300.3));
+}
+
+TEST(static_composition) {
+  // Same as the decorators composed by pointers.
+  const int VALUES[] = { 500, 520, 540, 560 };
+  NTC_Host::setAnalogValues(A1, VALUES, 4);
+  StaticSmoothThermistor<StaticAverageThermistor<NTC_Thermistor, 4, 0>, 2> composed(
+    A1, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE
+  );
+  const double first = composed.readCelsius();
+  const double second = composed.readCelsius();
+
+  NTC_Host::setAnalogValues(A1, VALUES, 4);
+  SmoothThermistor decorated(
+    new AverageThermistor(
+      new NTC_Thermistor(A1, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE), 4, 0
+    ), 2
+  );
+  CHECK_NEAR(decorated.readCelsius(), first, TOLERANCE);
+  CHECK_NEAR(decorated.readCelsius(), second, TOLERANCE);
+}
+
+TEST(static_smooth_unknown) {
+  const double KELVINS[] = { 300, NAN, 310, 320 };
+  StaticSmoothThermistor<ScriptedThermistor, 2> thermistor(KELVINS, 4);
+  CHECK_NEAR(300, thermistor.readKelvin(), TOLERANCE);
+  CHECK_EQUAL(NTC_NO_CENTI_CELSIUS, thermistor.readCentiCelsius());
+  // Restarts with the next reading.
+  CHECK_NEAR(310, thermistor.readKelvin(), TOLERANCE);
+  CHECK_NEAR(315, thermistor.readKelvin(), TOLERANCE);
+}
+
+TEST(adapter) {
+  const int VALUES[] = { 700 };
+  NTC_Host::setAnalogValues(A2, VALUES, 1);
+  ThermistorAdapter<StaticAverageThermistor<NTC_Thermistor, 3, 0> > adapter(
+    A2, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE
+  );
+  Thermistor* thermistor = &adapter;
+  CHECK_NEAR(referenceCelsius(700), thermistor->readCelsius(), TOLERANCE);
+}
+
+TEST(smooth_source) {
+  const int VALUES[] = { 100, 200 };
+  SmoothAdcSource source(new FakeAdcSource(VALUES, 2), 1);
+  CHECK_EQUAL(100, source.read());
+  CHECK_EQUAL(150, source.read());
+  CHECK_EQUAL(1023, source.scaleResolution(1023));
+}
+
+TEST(smooth_source_settles) {
+  // Settles at the value from above as from below.
+  int VALUES[100];
+  for (int first = 400; first <= 600; first += 200) {
+    VALUES[0] = first;
+    for (int i = 1; i < 100; ++i) {
+      VALUES[i] = 500;
+    }
+    SmoothAdcSource source(new FakeAdcSource(VALUES, 100), 4);
+    int value = 0;
+    for (int i = 0; i < 100; ++i) {
+      value = source.read();
+    }
+    CHECK_EQUAL(500, value);
+  }
+}
+
+TEST(oversampling_source) {
+  const int VALUES[] = { 500, 501 };
+  OversamplingAdcSource source(new FakeAdcSource(VALUES, 2), 2);
+  // 16 values, the sum 8008 decimated by 2 bits.
+  CHECK_EQUAL(2002, source.read());
+  CHECK_EQUAL(4092, source.scaleResolution(1023));
+
+  OversamplingAdcSource scaled(new FakeAdcSource(VALUES, 2), 2);
+  NTC_Thermistor thermistor(&scaled, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE);
+  CHECK_NEAR(referenceCelsius(500.5), thermistor.readCelsius(), TOLERANCE);
+}
+
+TEST(dma_source) {
+  // Channel 0 of 2 interleaved channels.
+  const volatile uint16_t BUFFER[] = { 100, 900, 104, 900, 108, 900, 112, 900 };
+  DmaAdcSource source(BUFFER, 8, 2, 0);
+  CHECK_EQUAL(106, source.read());
+  // Bursts take the samples one by one, going on from the last burst.
+  int burst[3];
+  source.readBurst(burst, 3);
+  CHECK_EQUAL(100, burst[0]);
+  CHECK_EQUAL(108, burst[2]);
+  source.readBurst(burst, 3);
+  CHECK_EQUAL(112, burst[0]);
+  CHECK_EQUAL(100, burst[1]);
+}
+
+TEST(ratiometric_source) {
+  const int VALUES[] = { 600 };
+  // The supply sagged by 5%.
+  const int REFERENCES[] = { 1900 };
+  RatiometricAdcSource source(new FakeAdcSource(VALUES, 1), new FakeAdcSource(REFERENCES, 1), 2000);
+  CHECK_NEAR(600 * 2000.0 / 1900, source.read(), 1);
+}
+
+TEST(duty_cycled) {
+  const double KELVINS[] = { 300 };
+  DutyCycledThermistor thermistor(new ScriptedThermistor(KELVINS, 1), 7, 1500);
+  CHECK_NEAR(300, thermistor.readKelvin(), TOLERANCE);
+  CHECK(thermistor.getPoweredTime() >= 1500);
+
+  // Non-blocking: powers on, then reads after the settle time.
+  CHECK(!thermistor.update());
+  CHECK(!thermistor.isReady());
+  delay(2);
+  CHECK(thermistor.update());
+  CHECK(thermistor.isReady());
+  CHECK_NEAR(300, thermistor.getKelvin(), TOLERANCE);
+}
+
+TEST(duty_cycled_blocking_while_settling) {
+  const double KELVINS[] = { 300, 310 };
+  DutyCycledThermistor thermistor(new ScriptedThermistor(KELVINS, 2), 7, 1500);
+  CHECK(!thermistor.update());
+  // Waits the rest of the settle time and keeps the divider on.
+  CHECK_NEAR(300, thermistor.readKelvin(), TOLERANCE);
+  CHECK(thermistor.update());
+  CHECK_NEAR(310, thermistor.getKelvin(), TOLERANCE);
+  CHECK(thermistor.getPoweredTime() >= 1500);
+}
+
+static int bandChanges = 0;
+static int lastBand = -1;
+
+static void onBandChange(const int band, int) {
+  ++bandChanges;
+  lastBand = band;
+}
+
+TEST(threshold) {
+  const int VALUES[] = {
+    referenceAnalog(25),
+    referenceAnalog(55),
+    referenceAnalog(49), // within the hysteresis
+    referenceAnalog(47),
+    referenceAnalog(90)
+  };
+  NTC_Host::setAnalogValues(A3, VALUES, 5);
+  ThresholdThermistor<2> thermistor(A3, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE);
+  CHECK(thermistor.addThreshold(50, 2));
+  CHECK(thermistor.addThreshold(80, 2));
+  thermistor.onBandChange(onBandChange);
+
+  CHECK(thermistor.update());
+  CHECK_EQUAL(0, thermistor.getBand());
+  CHECK(thermistor.update());
+  CHECK_EQUAL(1, thermistor.getBand());
+  CHECK(!thermistor.update());
+  CHECK_EQUAL(1, thermistor.getBand());
+  CHECK(thermistor.update());
+  CHECK_EQUAL(0, thermistor.getBand());
+  CHECK(thermistor.update());
+  CHECK_EQUAL(2, thermistor.getBand());
+  CHECK_EQUAL(4, bandChanges);
+  CHECK_EQUAL(2, lastBand);
+  CHECK_NEAR(90, thermistor.getCelsius(), 0.5);
+}
+
+TEST(background) {
+  const int VALUES[] = { 600, 602 };
+  NTC_Host::setAnalogValues(A4, VALUES, 2);
+  BackgroundThermistor<8> thermistor(A4, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE);
+  CHECK(!thermistor.isReady());
+  CHECK(!thermistor.process());
+  // Nothing published: not a temperature.
+  CHECK(isnan(thermistor.readCelsius()));
+  CHECK_EQUAL(NTC_NO_CENTI_CELSIUS, thermistor.readCentiCelsius());
+  CHECK(thermistor.sample());
+  CHECK(thermistor.sample());
+  CHECK(thermistor.process());
+  CHECK(thermistor.isReady());
+  // The mean is converted once.
+  CHECK_NEAR(referenceCelsius(601), thermistor.readCelsius(), TOLERANCE);
+  CHECK_EQUAL(601, thermistor.read().analog);
+  CHECK_NEAR(referenceCelsius(601) * 100, thermistor.readCentiCelsius(), 1);
+  // Published readings do not read the port.
+  CHECK_NEAR(referenceCelsius(601), thermistor.readCelsius(), TOLERANCE);
+}
+
+int main() {
+  return NTC_Test::run();
+}
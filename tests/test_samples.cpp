@@ -0,0 +1,181 @@
+/**
+  Samples converted on demand (LazySample)
+  and the sample-level decorators.
+*/
+#include "NTC_Test.h"
+#include <NTC_Thermistor.h>
+#include <NTC_TableThermistor.h>
+#include <NTC_FixedThermistor.h>
+#include <AverageSampleThermistor.h>
+#include <SmoothSampleThermistor.h>
+#include <SampleThermistorAdapter.h>
+#include <BetaModel.h>
+#include <FakeAdcSource.h>
+
+#define REFERENCE_RESISTANCE 8000
+#define NOMINAL_RESISTANCE 100000
+#define NOMINAL_TEMPERATURE 25
+#define B_VALUE 3950
+
+static const double TOLERANCE = 0.01;
+
+static double referenceCelsius(const double analog) {
+  const double resistance = REFERENCE_RESISTANCE / (1023 / analog - 1);
+  return 1 / (1 / (NOMINAL_TEMPERATURE + 273.15) +
+    log(resistance / NOMINAL_RESISTANCE) / B_VALUE) - 273.15;
+}
+
+TEST(converted_on_demand) {
+  const int VALUES[] = { 600 };
+  FakeAdcSource source(VALUES, 1);
+  NTC_Thermistor thermistor(&source, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE);
+  LazySample sample = thermistor.readSample();
+  CHECK_EQUAL(600, sample.getAnalog());
+  CHECK(!sample.isConverted());
+  CHECK_NEAR(referenceCelsius(600), sample.getCelsius(), TOLERANCE);
+  CHECK(sample.isConverted());
+  CHECK_NEAR(referenceCelsius(600) + 273.15, sample.getKelvin(), TOLERANCE);
+  CHECK_NEAR(referenceCelsius(600) * 1.8 + 32, sample.getFahrenheit(), 2 * TOLERANCE);
+  // One analog reading per sample.
+  CHECK_EQUAL(1, source.getReadingsCount());
+}
+
+TEST(same_as_readings) {
+  const int VALUES[] = { 123, 456, 947 };
+  FakeAdcSource source(VALUES, 3);
+  NTC_Thermistor thermistor(&source, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE);
+  for (int i = 0; i < 3; ++i) {
+    LazySample sample = thermistor.readSample();
+    const ThermistorReading reading = sample.toReading();
+    CHECK_NEAR(referenceCelsius(VALUES[i]), reading.celsius, TOLERANCE);
+    CHECK_EQUAL(VALUES[i], reading.analog);
+  }
+  // The integer path of readCentiCelsius(), whatever is converted before.
+  for (int i = 0; i < 3; ++i) {
+    FakeAdcSource value(&VALUES[i], 1);
+    NTC_Thermistor other(&value, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE);
+    const int32_t centiCelsius = other.readCentiCelsius();
+    LazySample sample = other.readSample();
+    CHECK_EQUAL(centiCelsius, sample.getCentiCelsius());
+    sample.getCelsius();
+    CHECK_EQUAL(centiCelsius, sample.getCentiCelsius());
+  }
+}
+
+TEST(with_model) {
+  const int VALUES[] = { 300 };
+  FakeAdcSource source(VALUES, 1);
+  BetaModel model(NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE);
+  NTC_Thermistor thermistor(&source, REFERENCE_RESISTANCE, &model);
+  LazySample sample = thermistor.readSample();
+  CHECK_NEAR(referenceCelsius(300), sample.getCelsius(), TOLERANCE);
+  CHECK_EQUAL(thermistor.readCentiCelsius(), sample.getCentiCelsius());
+}
+
+TEST(with_analog) {
+  const int VALUES[] = { 600 };
+  FakeAdcSource source(VALUES, 1);
+  NTC_Thermistor thermistor(&source, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE);
+  LazySample sample = thermistor.readSample();
+  sample.getCelsius();
+  // Same converter, a new value, not converted yet.
+  LazySample other = sample.withAnalog(700.5);
+  CHECK(!other.isConverted());
+  CHECK_NEAR(referenceCelsius(700.5), other.getCelsius(), TOLERANCE);
+}
+
+TEST(empty_sample) {
+  LazySample sample;
+  CHECK(isnan(sample.getAnalog()));
+  CHECK(isnan(sample.getCelsius()));
+  CHECK_EQUAL(NTC_NO_CENTI_CELSIUS, sample.getCentiCelsius());
+}
+
+TEST(unknown_analog) {
+  const int VALUES[] = { 600 };
+  FakeAdcSource source(VALUES, 1);
+  NTC_TableThermistor thermistor(&source, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE, 33);
+  LazySample sample = thermistor.readSample().withAnalog(NAN);
+  CHECK(isnan(sample.getCelsius()));
+  CHECK_EQUAL(NTC_NO_CENTI_CELSIUS, sample.getCentiCelsius());
+}
+
+// Samples of a table convert through the table, as the readings.
+static void checkSamples(NTC_Thermistor& thermistor) {
+  for (int i = 0; i < 3; ++i) {
+    const ThermistorReading reading = thermistor.read();
+    const int32_t centiCelsius = thermistor.readCentiCelsius();
+    LazySample sample = thermistor.readSample();
+    CHECK_EQUAL(reading.analog, sample.getAnalog());
+    CHECK_NEAR(reading.celsius, sample.getCelsius(), 1e-4);
+    CHECK_EQUAL(centiCelsius, sample.getCentiCelsius());
+    if (isnan(reading.resistance)) {
+      CHECK(isnan(sample.getResistance()));
+    } else {
+      CHECK_NEAR(reading.resistance, sample.getResistance(), 1e-3);
+    }
+  }
+}
+
+TEST(ram_table_samples) {
+  // Each value three times: read(), readCentiCelsius(), readSample().
+  const int VALUES[] = { 300, 300, 300, 947, 947, 947, 1000, 1000, 1000 };
+  FakeAdcSource source(VALUES, 9);
+  NTC_TableThermistor thermistor(&source, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE, 9);
+  checkSamples(thermistor);
+}
+
+TEST(flash_table_samples) {
+  // Analog values of -40 C...150 C.
+  static const float TABLE[] PROGMEM = { 1021, 1007.8, 952.3, 806.4, 576.4, 354.9, 204.3 };
+  const int VALUES[] = { 100, 100, 100, 512, 512, 512, 950, 950, 950 };
+  NTC_Host::setAnalogValues(A1, VALUES, 9);
+  NTC_TableThermistor thermistor(A1, TABLE, 7);
+  checkSamples(thermistor);
+}
+
+TEST(fixed_table_samples) {
+  const int VALUES[] = { 250, 250, 250, 700, 700, 700, 947, 947, 947 };
+  NTC_Host::setAnalogValues(A2, VALUES, 9);
+  NTC_FixedThermistor<REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE> thermistor(A2);
+  checkSamples(thermistor);
+  CHECK_NEAR(referenceCelsius(250), thermistor.readSample().getCelsius(), 0.5);
+}
+
+TEST(average_samples) {
+  const int VALUES[] = { 500, 510, 520, 530 };
+  FakeAdcSource source(VALUES, 4);
+  AverageSampleThermistor thermistor(
+    new NTC_Thermistor(&source, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE), 4, 0
+  );
+  LazySample sample = thermistor.readSample();
+  // Analog values are averaged, the mean is converted once.
+  CHECK_EQUAL(515, sample.getAnalog());
+  CHECK(!sample.isConverted());
+  CHECK_NEAR(referenceCelsius(515), sample.getCelsius(), TOLERANCE);
+}
+
+TEST(smooth_samples) {
+  const int VALUES[] = { 500, 520 };
+  FakeAdcSource source(VALUES, 2);
+  SmoothSampleThermistor thermistor(
+    new NTC_Thermistor(&source, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE), 2
+  );
+  CHECK_EQUAL(500, thermistor.readSample().getAnalog());
+  CHECK_EQUAL(510, thermistor.readSample().getAnalog());
+}
+
+TEST(sample_adapter) {
+  const int VALUES[] = { 640, 660 };
+  FakeAdcSource source(VALUES, 2);
+  SampleThermistorAdapter adapter(new AverageSampleThermistor(
+    new NTC_Thermistor(&source, REFERENCE_RESISTANCE, NOMINAL_RESISTANCE, NOMINAL_TEMPERATURE, B_VALUE), 2, 0
+  ));
+  Thermistor* thermistor = &adapter;
+  CHECK_NEAR(referenceCelsius(650), thermistor->readCelsius(), TOLERANCE);
+  CHECK_NEAR(referenceCelsius(650) + 273.15, thermistor->readKelvin(), TOLERANCE);
+}
+
+int main() {
+  return NTC_Test::run();
+}
@@ -0,0 +1,260 @@
+/**
+  Binary frames of ThermistorStream and their decoder.
+*/
+#include "NTC_Test.h"
+#include <ThermistorStream.h>
+#include "../extras/ThermistorStreamDecoder/ThermistorStreamDecoder.h"
+
+/**
+  Keeps the written bytes.
+*/
+class Buffer final : public Print {
+
+  public:
+    uint8_t bytes[1024];
+    size_t size = 0;
+
+    using Print::write;
+
+    size_t write(const uint8_t data) override {
+      if (this->size == sizeof(this->bytes)) {
+        return 0;
+      }
+      this->bytes[this->size++] = data;
+      return 1;
+    }
+};
+
+/**
+  Keeps the decoded values.
+*/
+struct Samples {
+  ThermistorSample values[256];
+  int count = 0;
+
+  ThermistorStreamDecoder::SampleCallback callback() {
+    return [this](const ThermistorSample& sample) {
+      this->values[this->count++] = sample;
+    };
+  }
+};
+
+TEST(temperatures) {
+  const int32_t CENTI_CELSIUS[] = { 2512, 2520, 2400, 2401, -1234, 2000 };
+  Buffer buffer;
+  ThermistorStream<1> stream(buffer);
+  for (int i = 0; i < 6; ++i) {
+    CHECK(stream.writeCentiCelsius(0, CENTI_CELSIUS[i]));
+  }
+  ThermistorStreamDecoder decoder;
+  Samples samples;
+  CHECK_EQUAL(6, decoder.decode(buffer.bytes, buffer.size, samples.callback()));
+  CHECK_EQUAL(6, samples.count);
+  for (int i = 0; i < 6; ++i) {
+    CHECK(!samples.values[i].raw);
+    CHECK_EQUAL(0, samples.values[i].channel);
+    CHECK_EQUAL(CENTI_CELSIUS[i], samples.values[i].centiCelsius);
+  }
+  CHECK_EQUAL(0, decoder.getErrors());
+  CHECK_EQUAL(0, decoder.getSkippedBytes());
+}
+
+TEST(frame_sizes) {
+  Buffer buffer;
+  ThermistorStream<8> stream(buffer);
+  // A full temperature, then a difference.
+  stream.writeCentiCelsius(0, 2500);
+  CHECK_EQUAL(9, buffer.size);
+  stream.writeCentiCelsius(0, 2510);
+  CHECK_EQUAL(9 + 8, buffer.size);
+
+  const int32_t CENTI_CELSIUS[] = { 100, 200, 300, 400, 500, 600, 700, 800 };
+  buffer.size = 0;
+  stream.writeCentiCelsius(0, CENTI_CELSIUS, 8);
+  CHECK_EQUAL(23, buffer.size);
+}
+
+TEST(key_interval) {
+  Buffer buffer;
+  ThermistorStream<1> stream(buffer, 3);
+  for (int i = 0; i < 6; ++i) {
+    stream.writeCentiCelsius(0, 2500 + i);
+  }
+  // Full temperatures at 0 and 3.
+  CHECK_EQUAL(2 * 9 + 4 * 8, buffer.size);
+}
+
+TEST(raw_values) {
+  const uint16_t ANALOGS[] = { 947, 1023, 0 };
+  Buffer buffer;
+  ThermistorStream<4> stream(buffer);
+  CHECK(stream.writeRaw(1, ANALOGS, 3));
+  CHECK(!stream.writeRaw(2, ANALOGS, 3));
+  ThermistorStreamDecoder decoder;
+  Samples samples;
+  CHECK_EQUAL(3, decoder.decode(buffer.bytes, buffer.size, samples.callback()));
+  for (int i = 0; i < 3; ++i) {
+    CHECK(samples.values[i].raw);
+    CHECK_EQUAL(1 + i, samples.values[i].channel);
+    CHECK_EQUAL(ANALOGS[i], samples.values[i].analog);
+  }
+}
+
+TEST(limited_temperatures) {
+  Buffer buffer;
+  ThermistorStream<1> stream(buffer);
+  stream.writeCentiCelsius(0, 40000);
+  stream.writeCentiCelsius(0, -40000);
+  ThermistorStreamDecoder decoder;
+  Samples samples;
+  decoder.decode(buffer.bytes, buffer.size, samples.callback());
+  CHECK_EQUAL(32767, samples.values[0].centiCelsius);
+  CHECK_EQUAL(-32767, samples.values[1].centiCelsius);
+}
+
+TEST(unknown_temperatures) {
+  Buffer buffer;
+  ThermistorStream<1> stream(buffer);
+  stream.writeCentiCelsius(0, 2000);
+  stream.writeCentiCelsius(0, NTC_NO_CENTI_CELSIUS);
+  stream.writeCentiCelsius(0, 2010);
+  stream.writeCentiCelsius(0, 2020);
+  ThermistorStreamDecoder decoder;
+  Samples samples;
+  decoder.decode(buffer.bytes, buffer.size, samples.callback());
+  CHECK_EQUAL(4, samples.count);
+  CHECK_EQUAL(2000, samples.values[0].centiCelsius);
+  CHECK_EQUAL(ThermistorSample::NO_CENTI_CELSIUS, samples.values[1].centiCelsius);
+  CHECK_EQUAL(2010, samples.values[2].centiCelsius);
+  CHECK_EQUAL(2020, samples.values[3].centiCelsius);
+  // Full temperatures to and from the unknown one.
+  CHECK_EQUAL(9 + 9 + 9 + 8, (int) buffer.size);
+}
+
+TEST(chunks) {
+  Buffer buffer;
+  ThermistorStream<2> stream(buffer);
+  for (int i = 0; i < 10; ++i) {
+    const int32_t CENTI_CELSIUS[] = { 2000 + i, 3000 - i };
+    stream.writeCentiCelsius(0, CENTI_CELSIUS, 2);
+  }
+  // One byte at a time.
+  ThermistorStreamDecoder decoder;
+  Samples samples;
+  for (size_t i = 0; i < buffer.size; ++i) {
+    decoder.decode(buffer.bytes + i, 1, samples.callback());
+  }
+  CHECK_EQUAL(20, samples.count);
+  CHECK_EQUAL(2009, samples.values[18].centiCelsius);
+  CHECK_EQUAL(2991, samples.values[19].centiCelsius);
+  CHECK_EQUAL(10, decoder.getFrames());
+}
+
+TEST(corrupted_key_frame) {
+  Buffer buffer;
+  ThermistorStream<1> stream(buffer, 4);
+  for (int i = 0; i < 8; ++i) {
+    stream.writeCentiCelsius(0, 2500 + i);
+  }
+  // The first full temperature is lost, its differences are skipped.
+  buffer.bytes[6] ^= 0x01;
+  ThermistorStreamDecoder decoder;
+  Samples samples;
+  CHECK_EQUAL(4, decoder.decode(buffer.bytes, buffer.size, samples.callback()));
+  CHECK_EQUAL(1, decoder.getErrors());
+  CHECK_EQUAL(3, decoder.getSkippedValues());
+  CHECK_EQUAL(2504, samples.values[0].centiCelsius);
+  CHECK_EQUAL(2507, samples.values[3].centiCelsius);
+}
+
+TEST(corrupted_delta_frame) {
+  Buffer buffer;
+  ThermistorStream<1> stream(buffer, 4);
+  for (int i = 0; i < 8; ++i) {
+    stream.writeCentiCelsius(0, 2500 + 10 * i);
+  }
+  // The difference of 2520 is lost: 2530 and 2540 are unknown until 2540 is full.
+  buffer.bytes[9 + 8 + 6] ^= 0x01;
+  ThermistorStreamDecoder decoder;
+  Samples samples;
+  CHECK_EQUAL(6, decoder.decode(buffer.bytes, buffer.size, samples.callback()));
+  CHECK_EQUAL(1, decoder.getErrors());
+  CHECK_EQUAL(1, decoder.getSkippedValues());
+  const int32_t EXPECTED[] = { 2500, 2510, 2540, 2550, 2560, 2570 };
+  for (int i = 0; i < 6; ++i) {
+    CHECK_EQUAL(EXPECTED[i], samples.values[i].centiCelsius);
+  }
+}
+
+TEST(cut_frame) {
+  Buffer buffer;
+  ThermistorStream<1> stream(buffer, 4);
+  for (int i = 0; i < 8; ++i) {
+    stream.writeCentiCelsius(0, 2500 + 10 * i);
+  }
+  // The end of the second frame (a difference) is lost.
+  Buffer cut;
+  cut.write(buffer.bytes, 9 + 4);
+  cut.write(buffer.bytes + 9 + 8, buffer.size - 9 - 8);
+  ThermistorStreamDecoder decoder;
+  Samples samples;
+  decoder.decode(cut.bytes, cut.size, samples.callback());
+  for (int i = 0; i < samples.count; ++i) {
+    CHECK(samples.values[i].centiCelsius != 2520);
+    CHECK((samples.values[i].centiCelsius - 2500) % 10 == 0);
+  }
+  CHECK_EQUAL(2570, samples.values[samples.count - 1].centiCelsius);
+}
+
+/**
+  Fails to write the frames while broken.
+*/
+class Unreliable final : public Print {
+
+  public:
+    Buffer buffer;
+    bool broken = false;
+
+    using Print::write;
+
+    size_t write(const uint8_t data) override {
+      return this->broken ? 0 : this->buffer.write(data);
+    }
+
+    size_t write(const uint8_t* bytes, const size_t size) override {
+      return this->broken ? 0 : this->buffer.write(bytes, size);
+    }
+};
+
+TEST(unwritten_frame) {
+  Unreliable output;
+  ThermistorStream<1> stream(output, 16);
+  CHECK(stream.writeCentiCelsius(0, 2500));
+  output.broken = true;
+  CHECK(!stream.writeCentiCelsius(0, 2510));
+  output.broken = false;
+  // A full temperature, not a difference to the unwritten one.
+  CHECK(stream.writeCentiCelsius(0, 2520));
+  CHECK_EQUAL(9 + 9, output.buffer.size);
+  ThermistorStreamDecoder decoder;
+  Samples samples;
+  CHECK_EQUAL(2, decoder.decode(output.buffer.bytes, output.buffer.size, samples.callback()));
+  CHECK_EQUAL(2520, samples.values[1].centiCelsius);
+}
+
+TEST(bytes_between_frames) {
+  Buffer buffer;
+  buffer.write((uint8_t) 0x12);
+  buffer.write((uint8_t) ThermistorFrame::SYNC);
+  ThermistorStream<1> stream(buffer);
+  stream.writeCentiCelsius(0, 2500);
+  ThermistorStreamDecoder decoder;
+  Samples samples;
+  CHECK_EQUAL(1, decoder.decode(buffer.bytes, buffer.size, samples.callback()));
+  CHECK_EQUAL(2500, samples.values[0].centiCelsius);
+  CHECK_EQUAL(2, decoder.getSkippedBytes());
+}
+
+int main() {
+  return NTC_Test::run();
+}